@@ -64,6 +64,7 @@ public class EasySynth : ModuleRules
 				"MainFrame",
 				"PropertyEditor",
 				// Image formats
+				"ImageWrapper",
 				"UEOpenExrRTTI",
 				// JSON parsing
 				"Json", "JsonUtilities",
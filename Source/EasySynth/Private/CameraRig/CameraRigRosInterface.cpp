@@ -45,35 +45,85 @@ FReply FCameraRigRosInterface::OnImportCameraRigClicked()
 		return FReply::Handled();
 	}
 
-	// Helper method for displaying error messages
-	auto DisplayError = [](const FText& Message) {
+	// Read the camera rig from the selected file
+	FCameraRigData CameraRigData;
+	FText ErrorMessage;
+	if (!LoadCameraRig(OutFilenames[0], CameraRigData, ErrorMessage))
+	{
 		const FText MessageBoxTitle = LOCTEXT("InvalidJsonMessageBoxTitle", "Failed to load camera rig");
-		UE_LOG(LogEasySynth, Warning, TEXT("%s: %s"), *FString(__FUNCTION__), *Message.ToString())
-		FMessageDialog::Open(EAppMsgType::Ok, Message, MessageBoxTitle);
-	};
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage.ToString())
+		FMessageDialog::Open(EAppMsgType::Ok, ErrorMessage, MessageBoxTitle);
+		return FReply::Handled();
+	}
+
+	// Spawn the camera rig actor
+	AActor* CameraRigActor = Cast<AActor>(
+		GEditor->AddActor(
+			GEditor->GetEditorWorldContext().World()->GetCurrentLevel(),
+			AActor::StaticClass(),
+			FTransform(
+				FRotator::ZeroRotator,
+				FVector(0, 0, 0),
+				FVector(1, 1, 1))));
+	CameraRigActor->SetActorLabel("CameraRigActor");
+
+	// Create the rig actor root component
+	USceneComponent* RootComponent = NewObject<USceneComponent>(
+		CameraRigActor,
+		USceneComponent::GetDefaultSceneRootVariableName(),
+		RF_Transactional);
+	CameraRigActor->SetRootComponent(RootComponent);
+	CameraRigActor->AddInstanceComponent(RootComponent);
+	RootComponent->RegisterComponent();
 
+	// Add camera components to the rig actor
+	for (int i = 0; i < CameraRigData.Cameras.Num(); i++)
+	{
+		const FCameraRigData::FCameraData& Camera = CameraRigData.Cameras[i];
+
+		UCineCameraComponent * CameraComponent = NewObject<UCineCameraComponent>(
+			CameraRigActor,
+			UCineCameraComponent::StaticClass(),
+			*Camera.CameraName);
+		CameraComponent->AttachToComponent(
+			RootComponent,
+			FAttachmentTransformRules::KeepWorldTransform);
+		CameraRigActor->AddInstanceComponent(CameraComponent);
+		CameraComponent->RegisterComponent();
+
+		CameraComponent->SetRelativeTransform(Camera.Transform);
+		CameraComponent->SetFieldOfView(FieldOfView(Camera));
+
+		// Make camera components smaller so that the rig is easier to visualize
+		CameraComponent->SetRelativeScale3D(FVector(0.4f, 0.4f, 0.4f));
+	}
+
+	return FReply::Handled();
+}
+
+bool FCameraRigRosInterface::LoadCameraRig(
+	const FString& FilePath,
+	FCameraRigData& OutCameraRigData,
+	FText& OutErrorMessage)
+{
+	OutCameraRigData.Cameras.Empty();
 
 	// Read the selected file
 	FString FileContent;
-	if (!FFileHelper::LoadFileToString(FileContent, *OutFilenames[0]))
+	if (!FFileHelper::LoadFileToString(FileContent, *FilePath))
 	{
-		const FText ErrorMessage = LOCTEXT("CannotReadFileError", "Failed to open ROS JSON file");
-		DisplayError(ErrorMessage);
-		return FReply::Handled();
+		OutErrorMessage = LOCTEXT("CannotReadFileError", "Failed to open ROS JSON file");
+		return false;
 	}
 
 	// Parse JSON content into equivalent structure
 	FRosJsonContent RosJsonContent;
 	if (!FJsonObjectConverter::JsonObjectStringToUStruct(FileContent, &RosJsonContent, 0, 0))
 	{
-		const FText ErrorMessage = LOCTEXT("FileContentError", "Invalid ROS JSON file content");
-		DisplayError(ErrorMessage);
-		return FReply::Handled();
+		OutErrorMessage = LOCTEXT("FileContentError", "Invalid ROS JSON file content");
+		return false;
 	}
 
-	// Aggregated camera rig data
-	FCameraRigData CameraRigData;
-
 	for (auto& Element : RosJsonContent.cameras)
 	{
 		const FString& CameraName = Element.Key;
@@ -85,9 +135,8 @@ FReply FCameraRigRosInterface::OnImportCameraRigClicked()
 		// Get the sensor size
 		if (RosJsonCamera.sensor_size.Num() != 2)
 		{
-			const FText ErrorMessage = LOCTEXT("InvalidSensorError", "Expected 2 values for the sensor size");
-			DisplayError(ErrorMessage);
-			return FReply::Handled();
+			OutErrorMessage = LOCTEXT("InvalidSensorError", "Expected 2 values for the sensor size");
+			return false;
 		}
 		CameraData.SensorSize.X = RosJsonCamera.sensor_size[0];
 		CameraData.SensorSize.Y = RosJsonCamera.sensor_size[1];
@@ -101,9 +150,8 @@ FReply FCameraRigRosInterface::OnImportCameraRigClicked()
 		// Get focal length
 		if (RosJsonCamera.intrinsics.Num() != 9)
 		{
-			const FText ErrorMessage = LOCTEXT("InvalidSensorError", "Expected 9 values for camera intrinsics");
-			DisplayError(ErrorMessage);
-			return FReply::Handled();
+			OutErrorMessage = LOCTEXT("InvalidSensorError", "Expected 9 values for camera intrinsics");
+			return false;
 		}
 		CameraData.FocalLength = RosJsonCamera.intrinsics[0];
 		CameraData.PrincipalPointX = RosJsonCamera.intrinsics[2];
@@ -112,9 +160,8 @@ FReply FCameraRigRosInterface::OnImportCameraRigClicked()
 		// Get rotation
 		if (RosJsonCamera.rotation.Num() != 4)
 		{
-			const FText ErrorMessage = LOCTEXT("InvalidSensorError", "Expected 4 values for camera rotation");
-			DisplayError(ErrorMessage);
-			return FReply::Handled();
+			OutErrorMessage = LOCTEXT("InvalidSensorError", "Expected 4 values for camera rotation");
+			return false;
 		}
 		CameraData.Transform.SetRotation(FQuat(
 			RosJsonCamera.rotation[0],
@@ -125,64 +172,24 @@ FReply FCameraRigRosInterface::OnImportCameraRigClicked()
 		// Get translation
 		if (RosJsonCamera.translation.Num() != 3)
 		{
-			const FText ErrorMessage = LOCTEXT("InvalidSensorError", "Expected 3 values for camera translation");
-			DisplayError(ErrorMessage);
-			return FReply::Handled();
+			OutErrorMessage = LOCTEXT("InvalidSensorError", "Expected 3 values for camera translation");
+			return false;
 		}
 		CameraData.Transform.SetTranslation(FVector(
 			RosJsonCamera.translation[0],
 			RosJsonCamera.translation[1],
 			RosJsonCamera.translation[2]));
 
-		CameraRigData.Cameras.Add(CameraData);
+		OutCameraRigData.Cameras.Add(CameraData);
 	}
 
-	// Spawn the camera rig actor
-	AActor* CameraRigActor = Cast<AActor>(
-		GEditor->AddActor(
-			GEditor->GetEditorWorldContext().World()->GetCurrentLevel(),
-			AActor::StaticClass(),
-			FTransform(
-				FRotator::ZeroRotator,
-				FVector(0, 0, 0),
-				FVector(1, 1, 1))));
-	CameraRigActor->SetActorLabel("CameraRigActor");
-
-	// Create the rig actor root component
-	USceneComponent* RootComponent = NewObject<USceneComponent>(
-		CameraRigActor,
-		USceneComponent::GetDefaultSceneRootVariableName(),
-		RF_Transactional);
-	CameraRigActor->SetRootComponent(RootComponent);
-	CameraRigActor->AddInstanceComponent(RootComponent);
-	RootComponent->RegisterComponent();
-
-	// Add camera components to the rig actor
-	for (int i = 0; i < CameraRigData.Cameras.Num(); i++)
-	{
-		const FCameraRigData::FCameraData& Camera = CameraRigData.Cameras[i];
-
-		UCineCameraComponent * CameraComponent = NewObject<UCineCameraComponent>(
-			CameraRigActor,
-			UCineCameraComponent::StaticClass(),
-			*Camera.CameraName);
-		CameraComponent->AttachToComponent(
-			RootComponent,
-			FAttachmentTransformRules::KeepWorldTransform);
-		CameraRigActor->AddInstanceComponent(CameraComponent);
-		CameraComponent->RegisterComponent();
-
-		CameraComponent->SetRelativeTransform(Camera.Transform);
-
-		// Calculate field of view in degrees
-		const double FOV = 2 * UKismetMathLibrary::DegAtan2(Camera.SensorSize.X, Camera.FocalLength * 2.0f);
-		CameraComponent->SetFieldOfView(FOV);
-
-		// Make camera components smaller so that the rig is easier to visualize
-		CameraComponent->SetRelativeScale3D(FVector(0.4f, 0.4f, 0.4f));
-	}
+	return true;
+}
 
-	return FReply::Handled();
+double FCameraRigRosInterface::FieldOfView(const FCameraRigData::FCameraData& Camera)
+{
+	// Calculate field of view in degrees
+	return 2 * UKismetMathLibrary::DegAtan2(Camera.SensorSize.X, Camera.FocalLength * 2.0f);
 }
 
 bool FCameraRigRosInterface::ExportCameraRig(
@@ -217,6 +224,21 @@ bool FCameraRigRosInterface::ExportCameraRig(
 	return true;
 }
 
+TArray<double> FCameraRigRosInterface::CameraIntrinsics(const UCameraComponent* Camera, const FIntPoint& SensorSize)
+{
+	const double FocalLength = SensorSize.X / UKismetMathLibrary::DegTan(Camera->FieldOfView / 2.0f) / 2.0f;
+	const double PrincipalPointX = SensorSize.X / 2.0f;
+	const double PrincipalPointY = SensorSize.Y / 2.0f;
+	TArray<double> Intrinsics;
+	Intrinsics.Init(0, 9);
+	Intrinsics[0] = FocalLength;
+	Intrinsics[2] = PrincipalPointX;
+	Intrinsics[4] = FocalLength;
+	Intrinsics[5] = PrincipalPointY;
+	Intrinsics[8] = 1.0f;
+	return Intrinsics;
+}
+
 void FCameraRigRosInterface::AddCamera(
 	const int CameraId,
 	UCameraComponent* Camera,
@@ -226,15 +248,7 @@ void FCameraRigRosInterface::AddCamera(
 	FRosJsonCamera RosJsonCamera;
 
 	// Add intrinsics
-	const double FocalLength = SensorSize.X / UKismetMathLibrary::DegTan(Camera->FieldOfView / 2.0f) / 2.0f;
-	const double PrincipalPointX = SensorSize.X / 2.0f;
-	const double PrincipalPointY = SensorSize.Y / 2.0f;
-	RosJsonCamera.intrinsics.Init(0, 9);
-	RosJsonCamera.intrinsics[0] = FocalLength;
-	RosJsonCamera.intrinsics[2] = PrincipalPointX;
-	RosJsonCamera.intrinsics[4] = FocalLength;
-	RosJsonCamera.intrinsics[5] = PrincipalPointY;
-	RosJsonCamera.intrinsics[8] = 1.0f;
+	RosJsonCamera.intrinsics = CameraIntrinsics(Camera, SensorSize);
 
 	// Prepare transform
 	FTransform Transform = Camera->GetRelativeTransform();
@@ -0,0 +1,148 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "ClassIndexOutput/MoviePipelineClassIndexOutput.h"
+
+#include "Async/ParallelFor.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Misc/FileHelper.h"
+#include "Modules/ModuleManager.h"
+#include "MoviePipelineImageQuantization.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+#include "DatasetShardPacker.h"
+#include "EasySynth.h"
+
+
+const int32 FClassIndexImageWriteTask::MaxEightBitIndices = 256;
+const FString FClassIndexImageWriteTask::UnknownClassName(TEXT("unknown"));
+
+bool FClassIndexImageWriteTask::RunTask()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(EasySynthClassIndexWrite);
+
+	// Class colors are matched against the 8-bit values regular semantic PNG images would hold
+	if (!PixelData.IsValid())
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Missing image data for %s"), *FString(__FUNCTION__), *Filename)
+		return false;
+	}
+	const TUniquePtr<FImagePixelData> ColorData = UE::MoviePipeline::QuantizeImagePixelDataToBitDepth(PixelData.Get(), 8);
+	PixelData.Reset();
+
+	TArray64<uint8> Indices;
+	if (!MapClassIndices(ColorData.Get(), Indices))
+	{
+		return false;
+	}
+
+	// The image wrapper module is loaded on the game thread before tasks are queued
+	IImageWrapperModule& ImageWrapperModule = FModuleManager::GetModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
+	const FIntPoint Size = ColorData->GetSize();
+	const int32 BitDepth = (ClassColors.Num() + 1 > MaxEightBitIndices) ? 16 : 8;
+	if (!ImageWrapper.IsValid() ||
+		!ImageWrapper->SetRaw(Indices.GetData(), Indices.Num(), Size.X, Size.Y, ERGBFormat::Gray, BitDepth))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not encode the class index image %s"), *FString(__FUNCTION__), *Filename)
+		return false;
+	}
+
+	// Packed images are handed to the dataset shard packer instead of being written
+	TArray64<uint8> EncodedData = ImageWrapper->GetCompressed();
+	if (FDatasetShardPacker::IsPacked(Filename))
+	{
+		return FDatasetShardPacker::PackImage(Filename, MoveTemp(EncodedData));
+	}
+	if (!FFileHelper::SaveArrayToFile(EncodedData, *Filename))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving the file %s"), *FString(__FUNCTION__), *Filename)
+		return false;
+	}
+
+	return true;
+}
+
+bool FClassIndexImageWriteTask::MapClassIndices(const FImagePixelData* ColorData, TArray64<uint8>& OutIndices) const
+{
+	const void* RawData;
+	int64 RawDataSize;
+	if (ColorData == nullptr ||
+		ColorData->GetType() != EImagePixelType::Color ||
+		!ColorData->GetRawData(RawData, RawDataSize))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Expected 8-bit image data for %s"), *FString(__FUNCTION__), *Filename)
+		return false;
+	}
+	if (ClassColors.Num() == 0 || ClassColors.Num() > MAX_uint16)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Invalid number of semantic classes %d"),
+			*FString(__FUNCTION__), ClassColors.Num())
+		return false;
+	}
+
+	// If two classes share a color, pixels are assigned to the first one
+	TMap<FColor, uint16> ColorIndices;
+	for (int32 i = 0; i < ClassColors.Num(); i++)
+	{
+		const FColor OpaqueColor(ClassColors[i].R, ClassColors[i].G, ClassColors[i].B);
+		if (!ColorIndices.Contains(OpaqueColor))
+		{
+			ColorIndices.Add(OpaqueColor, static_cast<uint16>(i));
+		}
+	}
+
+	const FIntPoint Size = ColorData->GetSize();
+	const bool bSixteenBit = (ClassColors.Num() + 1 > MaxEightBitIndices);
+	const uint16 UnknownIndex = static_cast<uint16>(UnknownClassIndex(ClassColors.Num()));
+	OutIndices.SetNumUninitialized(int64(Size.X) * Size.Y * (bSixteenBit ? 2 : 1));
+
+	const FColor* Colors = static_cast<const FColor*>(RawData);
+	uint8* Indices8 = OutIndices.GetData();
+	uint16* Indices16 = reinterpret_cast<uint16*>(OutIndices.GetData());
+	ParallelFor(Size.Y, [&ColorIndices, Colors, Indices8, Indices16, bSixteenBit, UnknownIndex, Size](const int32 Row)
+	{
+		for (int32 Column = 0; Column < Size.X; Column++)
+		{
+			const int64 PixelIndex = int64(Row) * Size.X + Column;
+			const FColor& Color = Colors[PixelIndex];
+			const uint16* FoundIndex = ColorIndices.Find(FColor(Color.R, Color.G, Color.B));
+			const uint16 ClassIndex = (FoundIndex != nullptr) ? *FoundIndex : UnknownIndex;
+			if (bSixteenBit)
+			{
+				Indices16[PixelIndex] = ClassIndex;
+			}
+			else
+			{
+				Indices8[PixelIndex] = static_cast<uint8>(ClassIndex);
+			}
+		}
+	});
+
+	return true;
+}
+
+void UMoviePipelineImageSequenceOutput_ClassIndex::OnReceiveImageDataImpl(FMoviePipelineMergerOutputFrame* InMergedOutputFrame)
+{
+	check(InMergedOutputFrame);
+
+	// Write tasks run on worker threads, so the module cannot be loaded by them
+	FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+
+	const TCHAR* Extension = FileExtension();
+	for (TPair<FMoviePipelinePassIdentifier, TUniquePtr<FImagePixelData>>& RenderPassData : InMergedOutputFrame->ImageOutputData)
+	{
+		FString FinalFilePath;
+		FString FinalImageSequenceFileName;
+		FString ClipName;
+		ResolveOutputFilePath(InMergedOutputFrame, RenderPassData.Key, Extension, FinalFilePath, FinalImageSequenceFileName, ClipName);
+
+		// Merged frames are shared by all output settings, so the task quantizes its own copy
+		TUniquePtr<FClassIndexImageWriteTask> ClassIndexImageTask = MakeUnique<FClassIndexImageWriteTask>();
+		ClassIndexImageTask->Filename = FinalFilePath;
+		ClassIndexImageTask->ClassColors = ClassColors;
+		ClassIndexImageTask->PixelData = RenderPassData.Value->CopyImageData();
+
+		EnqueueWriteTask(MoveTemp(ClassIndexImageTask), InMergedOutputFrame, RenderPassData.Key, Extension, FinalFilePath, FinalImageSequenceFileName, ClipName);
+	}
+}
@@ -0,0 +1,79 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ImagePixelData.h"
+#include "ImageWriteTask.h"
+
+#include "ImageOutput/MoviePipelineImageOutputLocal.h"
+
+#include "MoviePipelineClassIndexOutput.generated.h"
+
+
+/**
+ * Image write task that maps semantic colors of an image to class indices
+ * and writes them as a single channel grayscale PNG file
+ * Pixels not matching any class color get the reserved unknown index, following the last class
+ * Indices are 8-bit for up to 255 classes and 16-bit otherwise
+*/
+class FClassIndexImageWriteTask : public IImageWriteTaskBase
+{
+public:
+	FClassIndexImageWriteTask() {}
+
+	/** The filename to write to */
+	FString Filename;
+
+	/** The semantic image data, quantized to 8-bit by the task */
+	TUniquePtr<FImagePixelData> PixelData;
+
+	/** Semantic class colors, the index of a color is the written class index */
+	TArray<FColor> ClassColors;
+
+	/** IImageWriteTaskBase interface */
+	bool RunTask() override;
+
+	/** IImageWriteTaskBase interface */
+	void OnAbandoned() override {}
+
+	/** Returns the index written for pixels not matching any of the classes */
+	static int32 UnknownClassIndex(const int32 NumClasses) { return NumClasses; }
+
+	/** Maximum number of indices written as 8-bit values, including the unknown index */
+	static const int32 MaxEightBitIndices;
+
+	/** Name of the unknown class inside the class index table */
+	static const FString UnknownClassName;
+
+private:
+	/** Maps colors of the 8-bit image to class indices, stored as uint8 or uint16 values */
+	bool MapClassIndices(const FImagePixelData* ColorData, TArray64<uint8>& OutIndices) const;
+};
+
+
+/**
+ * Movie pipeline output that writes semantic images as class index PNG files,
+ * using the class colors provided by the semantic image target
+*/
+UCLASS()
+class UMoviePipelineImageSequenceOutput_ClassIndex : public UMoviePipelineImageSequenceOutputLocalBase
+{
+	GENERATED_BODY()
+
+public:
+#if WITH_EDITOR
+	virtual FText GetDisplayText() const override { return NSLOCTEXT("MovieRenderPipeline", "ImgSequenceClassIndexSettingDisplayName", ".png Sequence [class indices]"); }
+#endif
+
+	UMoviePipelineImageSequenceOutput_ClassIndex()
+	{
+		OutputFormat = EImageFormat::PNG;
+	}
+
+	virtual void OnReceiveImageDataImpl(FMoviePipelineMergerOutputFrame* InMergedOutputFrame) override;
+
+	/** Semantic class colors, the index of a color is the class index written into images */
+	UPROPERTY(EditAnywhere, Category = "PNG")
+	TArray<FColor> ClassColors;
+};
@@ -0,0 +1,797 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "Commandlets/EasySynthRenderCommandlet.h"
+
+#include "Containers/Ticker.h"
+#include "FileHelpers.h"
+#include "HAL/FileManager.h"
+#include "JsonObjectConverter.h"
+#include "LevelSequence.h"
+#include "Misc/FileHelper.h"
+
+#include "EasySynth.h"
+#include "EXROutput/ExrCodecBenchmark.h"
+#include "PathUtils.h"
+#include "NpyFile.h"
+#include "RenderManifest.h"
+#include "RendererTargets/CameraPoseExporter.h"
+#include "RendererTargets/SequenceFrameEvaluator.h"
+#include "RenderTelemetry.h"
+#include "SequenceRenderer.h"
+#include "SequencerWrapper.h"
+#include "TextureStyles/TextureStyleManager.h"
+
+
+const int32 UEasySynthRenderCommandlet::ExitCodeSuccess = 0;
+const int32 UEasySynthRenderCommandlet::ExitCodeFailure = 1;
+const double UEasySynthRenderCommandlet::ProgressLogIntervalSeconds = 30.0;
+const int32 UEasySynthRenderCommandlet::DefaultBenchmarkImages = 8;
+const double UEasySynthRenderCommandlet::DefaultWorkerTimeoutSeconds = 1800.0;
+const float UEasySynthRenderCommandlet::WorkerPollIntervalSeconds = 5.0f;
+const int32 UEasySynthRenderCommandlet::MaxShardAttempts = 3;
+
+UEasySynthRenderCommandlet::UEasySynthRenderCommandlet() :
+	bRenderingSucceeded(false),
+	NumFailedSequences(0),
+	LastProgressLogTime(0.0),
+	ActiveShardWorkQueue(nullptr),
+	HeartbeatFramesCompleted(0)
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UEasySynthRenderCommandlet::Main(const FString& Params)
+{
+	UE_LOG(LogEasySynth, Log, TEXT("%s"), *FString(__FUNCTION__))
+
+	// Get the job spec file path from the command line
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+	const FString* SpecFilePath = ParamValues.Find(TEXT("Spec"));
+	if (SpecFilePath == nullptr)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Missing the -Spec=<SpecFile> parameter"), *FString(__FUNCTION__))
+		return ExitCodeFailure;
+	}
+
+	FRenderJobSpec JobSpec;
+	if (!LoadJobSpec(*SpecFilePath, JobSpec))
+	{
+		return ExitCodeFailure;
+	}
+
+	FRendererTargetOptions TargetOptions;
+	if (!JobSpec.GetRendererTargetOptions(TargetOptions))
+	{
+		return ExitCodeFailure;
+	}
+
+	// Benchmark EXR compression methods on images of a previous run if requested, without rendering
+	if (Switches.Contains(TEXT("BenchmarkExrCodecs")))
+	{
+		const FString* NumImagesValue = ParamValues.Find(TEXT("BenchmarkImages"));
+		const int32 ImagesPerTarget = (NumImagesValue != nullptr) ? FCString::Atoi(**NumImagesValue) : DefaultBenchmarkImages;
+		return BenchmarkExrCodecs(JobSpec, ImagesPerTarget);
+	}
+
+	// Only estimate the rendering cost if requested, sharding does not change it
+	const bool bDryRun = Switches.Contains(TEXT("DryRun"));
+
+	// Split the rendering between worker processes if requested
+	const FString* NumShardsValue = ParamValues.Find(TEXT("Shards"));
+	const int32 NumShards = (NumShardsValue != nullptr) ? FCString::Atoi(**NumShardsValue) : 1;
+	if (NumShards <= 0)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Expected a positive number of shards, got %s"),
+			*FString(__FUNCTION__), **NumShardsValue)
+		return ExitCodeFailure;
+	}
+	if (NumShards > 1 && !bDryRun)
+	{
+		const FString* WorkerTimeoutValue = ParamValues.Find(TEXT("WorkerTimeout"));
+		const double WorkerTimeoutSeconds = (WorkerTimeoutValue != nullptr) ?
+			FCString::Atod(**WorkerTimeoutValue) : DefaultWorkerTimeoutSeconds;
+		if (WorkerTimeoutSeconds <= 0.0)
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Expected a positive worker timeout, got %s"),
+				*FString(__FUNCTION__), **WorkerTimeoutValue)
+			return ExitCodeFailure;
+		}
+		return RunShardCoordinator(JobSpec, *SpecFilePath, NumShards, WorkerTimeoutSeconds);
+	}
+
+	// Load the requested map
+	if (!JobSpec.map.IsEmpty() && UEditorLoadingAndSavingUtils::LoadMap(JobSpec.map) == nullptr)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not load the map %s"), *FString(__FUNCTION__), *JobSpec.map)
+		return ExitCodeFailure;
+	}
+
+	// Benchmark the camera pose evaluation if requested, without rendering
+	if (Switches.Contains(TEXT("BenchmarkPoseExport")))
+	{
+		return BenchmarkPoseExport(JobSpec);
+	}
+
+	// Create the texture style manager and the sequence renderer, same as the plugin UI does
+	UTextureStyleManager* TextureStyleManager = NewObject<UTextureStyleManager>();
+	check(TextureStyleManager)
+	TextureStyleManager->AddToRoot();
+	TextureStyleManager->BindEvents();
+
+	USequenceRenderer* SequenceRenderer = NewObject<USequenceRenderer>();
+	check(SequenceRenderer)
+	SequenceRenderer->AddToRoot();
+	SequenceRenderer->SetTextureStyleManager(TextureStyleManager);
+	SequenceRenderer->SetCameraRigOverride(JobSpec.camera_rig);
+	SequenceRenderer->OnRenderingFinished().AddUObject(this, &UEasySynthRenderCommandlet::OnRenderingFinished);
+	SequenceRenderer->OnRenderProgress().AddUObject(this, &UEasySynthRenderCommandlet::OnRenderProgress);
+
+	int32 ExitCode = ExitCodeSuccess;
+
+	const FString* ShardQueueDir = ParamValues.Find(TEXT("ShardQueue"));
+	if (bDryRun)
+	{
+		ExitCode = EstimateRenderCost(SequenceRenderer, JobSpec, TargetOptions);
+	}
+	else if (ShardQueueDir != nullptr)
+	{
+		// Running as a worker of the sharded rendering
+		ExitCode = RunShardWorker(SequenceRenderer, JobSpec, TargetOptions, *ShardQueueDir);
+	}
+	else
+	{
+		// Render all sequences through the persistent queue, so a failed sequence does not stop the rest
+		TArray<FSequenceRenderJob> Jobs;
+		for (const FString& LevelSequencePath : JobSpec.level_sequences)
+		{
+			ULevelSequence* LevelSequence = LoadObject<ULevelSequence>(nullptr, *LevelSequencePath);
+			if (LevelSequence == nullptr)
+			{
+				UE_LOG(LogEasySynth, Error, TEXT("%s: Could not load the level sequence %s"),
+					*FString(__FUNCTION__), *LevelSequencePath)
+				NumFailedSequences++;
+				continue;
+			}
+			Jobs.Add(FSequenceRenderJob{
+				FAssetData(LevelSequence),
+				TargetOptions,
+				FIntPoint(JobSpec.resolution[0], JobSpec.resolution[1]),
+				SequenceOutputDir(JobSpec, LevelSequencePath) });
+		}
+
+		SequenceRenderer->SetRenderQueueFilePath(FPathUtils::RenderQueueFilePath(JobSpec.output_dir));
+		SequenceRenderer->OnQueueFinished().AddUObject(this, &UEasySynthRenderCommandlet::OnQueueFinished);
+		if (SequenceRenderer->RenderSequences(Jobs))
+		{
+			TickUntilRenderingFinished(SequenceRenderer);
+		}
+		else
+		{
+			NumFailedSequences = JobSpec.level_sequences.Num();
+		}
+
+		UE_LOG(LogEasySynth, Log, TEXT("%s: Rendered %d/%d sequences"), *FString(__FUNCTION__),
+			JobSpec.level_sequences.Num() - NumFailedSequences, JobSpec.level_sequences.Num())
+		ExitCode = (NumFailedSequences == 0) ? ExitCodeSuccess : ExitCodeFailure;
+	}
+
+	SequenceRenderer->RemoveFromRoot();
+	TextureStyleManager->RemoveFromRoot();
+
+	return ExitCode;
+}
+
+int32 UEasySynthRenderCommandlet::BenchmarkExrCodecs(const FRenderJobSpec& JobSpec, const int32 ImagesPerTarget)
+{
+	if (ImagesPerTarget <= 0)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Invalid number of benchmark images %d"), *FString(__FUNCTION__), ImagesPerTarget)
+		return ExitCodeFailure;
+	}
+
+	TArray<FString> OutputDirectories;
+	for (const FString& LevelSequencePath : JobSpec.level_sequences)
+	{
+		OutputDirectories.Add(SequenceOutputDir(JobSpec, LevelSequencePath));
+	}
+
+	const FString CsvFilePath = FPathUtils::ExrCodecBenchmarkFilePath(JobSpec.output_dir);
+	if (!FExrCodecBenchmark::Run(OutputDirectories, ImagesPerTarget, CsvFilePath))
+	{
+		return ExitCodeFailure;
+	}
+
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Benchmark results written to %s"), *FString(__FUNCTION__), *CsvFilePath)
+	return ExitCodeSuccess;
+}
+
+int32 UEasySynthRenderCommandlet::BenchmarkPoseExport(const FRenderJobSpec& JobSpec)
+{
+	// With a batch of a single frame both evaluation paths are the same, so there is nothing to compare
+	if (FSequenceFrameEvaluator::InterrogationBatchSize() == 1)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Set EasySynth.PoseInterrogationBatchSize to the batch size to benchmark"),
+			*FString(__FUNCTION__))
+		return ExitCodeFailure;
+	}
+
+	bool bAllMatching = true;
+	for (const FString& LevelSequencePath : JobSpec.level_sequences)
+	{
+		ULevelSequence* LevelSequence = LoadObject<ULevelSequence>(nullptr, *LevelSequencePath);
+		if (LevelSequence == nullptr)
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Could not load the level sequence %s"),
+				*FString(__FUNCTION__), *LevelSequencePath)
+			bAllMatching = false;
+			continue;
+		}
+		if (!FCameraPoseExporter::BenchmarkPoseEvaluation(LevelSequence))
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Pose evaluation paths do not match for %s"),
+				*FString(__FUNCTION__), *LevelSequencePath)
+			bAllMatching = false;
+		}
+	}
+
+	return bAllMatching ? ExitCodeSuccess : ExitCodeFailure;
+}
+
+int32 UEasySynthRenderCommandlet::EstimateRenderCost(
+	USequenceRenderer* SequenceRenderer,
+	const FRenderJobSpec& JobSpec,
+	const FRendererTargetOptions& TargetOptions)
+{
+	const FIntPoint OutputResolution(JobSpec.resolution[0], JobSpec.resolution[1]);
+
+	int64 TotalBytes = 0;
+	bool bAllEstimated = true;
+	for (const FString& LevelSequencePath : JobSpec.level_sequences)
+	{
+		ULevelSequence* LevelSequence = LoadObject<ULevelSequence>(nullptr, *LevelSequencePath);
+		if (LevelSequence == nullptr)
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Could not load the level sequence %s"),
+				*FString(__FUNCTION__), *LevelSequencePath)
+			bAllEstimated = false;
+			continue;
+		}
+
+		FRenderCostEstimate Estimate;
+		if (!SequenceRenderer->EstimateRenderCost(
+			FAssetData(LevelSequence),
+			TargetOptions,
+			OutputResolution,
+			SequenceOutputDir(JobSpec, LevelSequencePath),
+			Estimate))
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Could not estimate the cost of %s: %s"),
+				*FString(__FUNCTION__), *LevelSequencePath, *SequenceRenderer->GetErrorMessage())
+			bAllEstimated = false;
+			continue;
+		}
+		TotalBytes += Estimate.TotalBytes;
+	}
+
+	// Sequences share the output disk, so their total output has to fit
+	FRenderCostEstimate TotalEstimate;
+	TotalEstimate.TotalBytes = TotalBytes;
+	TotalEstimate.CheckFreeDiskSpace(JobSpec.output_dir);
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Estimated output size of all sequences is %lld bytes"),
+		*FString(__FUNCTION__), TotalBytes)
+	if (TotalEstimate.bExceedsFreeDiskSpace)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Estimated output size exceeds %lld bytes of free disk space"),
+			*FString(__FUNCTION__), TotalEstimate.FreeDiskBytes)
+		return ExitCodeFailure;
+	}
+
+	return bAllEstimated ? ExitCodeSuccess : ExitCodeFailure;
+}
+
+int32 UEasySynthRenderCommandlet::RunShardCoordinator(
+	const FRenderJobSpec& JobSpec,
+	const FString& SpecFilePath,
+	const int32 NumShards,
+	const double WorkerTimeoutSeconds)
+{
+	// Split the frame range of each sequence into contiguous shards
+	TArray<FRenderShard> Shards;
+	for (int SequenceId = 0; SequenceId < JobSpec.level_sequences.Num(); SequenceId++)
+	{
+		const FString& LevelSequencePath = JobSpec.level_sequences[SequenceId];
+		TRange<int32> SequenceFrameRange;
+		if (!GetSequenceFrameRange(LevelSequencePath, SequenceFrameRange))
+		{
+			return ExitCodeFailure;
+		}
+
+		const int32 StartFrame = SequenceFrameRange.GetLowerBoundValue();
+		const int32 EndFrame = SequenceFrameRange.GetUpperBoundValue();
+		const int32 FramesPerShard = FMath::DivideAndRoundUp(EndFrame - StartFrame, NumShards);
+		for (int ShardId = 0; ShardId < NumShards; ShardId++)
+		{
+			FRenderShard Shard;
+			Shard.id = FString::Printf(TEXT("%03d_%03d"), SequenceId, ShardId);
+			Shard.level_sequence = LevelSequencePath;
+			Shard.start_frame = StartFrame + ShardId * FramesPerShard;
+			Shard.end_frame = FMath::Min(Shard.start_frame + FramesPerShard, EndFrame);
+			Shard.output_dir = FPathUtils::ShardOutputDir(SequenceOutputDir(JobSpec, LevelSequencePath), Shard.id);
+			if (Shard.start_frame < Shard.end_frame)
+			{
+				Shards.Add(Shard);
+			}
+		}
+	}
+
+	// Publish the shards to the work queue
+	const FString ShardQueueDir = FPaths::ConvertRelativePathToFull(FPathUtils::ShardQueueDir(JobSpec.output_dir));
+	FShardWorkQueue ShardWorkQueue(ShardQueueDir);
+	if (!ShardWorkQueue.Create(Shards))
+	{
+		return ExitCodeFailure;
+	}
+
+	// Launch the workers, which claim shards until the queue is empty,
+	// there is no point in running more workers than there are shards
+	const FString WorkerParams = FString::Printf(
+		TEXT("\"%s\" -run=EasySynthRender -Spec=\"%s\" -ShardQueue=\"%s\" -AllowCommandletRendering -unattended -RenderOffscreen -nosplash"),
+		*FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()),
+		*FPaths::ConvertRelativePathToFull(SpecFilePath),
+		*ShardQueueDir);
+	const int32 NumWorkers = FMath::Min(NumShards, Shards.Num());
+	TMap<uint32, FProcHandle> Workers;
+	for (int WorkerId = 0; WorkerId < NumWorkers; WorkerId++)
+	{
+		LaunchShardWorker(WorkerParams, Workers);
+	}
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Rendering %d shards using %d workers"),
+		*FString(__FUNCTION__), Shards.Num(), Workers.Num())
+
+	// Crashed workers are replaced, but a limited number of times, in case every worker crashes
+	int32 NumWorkerLaunchesLeft = NumWorkers * (MaxShardAttempts - 1);
+	while (true)
+	{
+		FPlatformProcess::Sleep(WorkerPollIntervalSeconds);
+
+		for (auto WorkerIt = Workers.CreateIterator(); WorkerIt; ++WorkerIt)
+		{
+			if (!FPlatformProcess::IsProcRunning(WorkerIt.Value()))
+			{
+				FPlatformProcess::CloseProc(WorkerIt.Value());
+				WorkerIt.RemoveCurrent();
+			}
+		}
+
+		for (const FRenderShard& Shard : ShardWorkQueue.ClaimedShards())
+		{
+			FProcHandle* Worker = Workers.Find(Shard.worker_pid);
+			const double SecondsSinceHeartbeat = ShardWorkQueue.SecondsSinceHeartbeat(Shard);
+			if (Shard.worker_pid != 0 && Worker == nullptr)
+			{
+				// The claiming process exited without completing the shard
+				UE_LOG(LogEasySynth, Warning, TEXT("%s: Worker %u exited while rendering shard %s, requeueing it"),
+					*FString(__FUNCTION__), Shard.worker_pid, *Shard.id)
+				ShardWorkQueue.Requeue(Shard, MaxShardAttempts);
+			}
+			else if (SecondsSinceHeartbeat > WorkerTimeoutSeconds)
+			{
+				// The process stopped rendering, it is killed and its shard requeued once it exits,
+				// while a shard without a recorded process lost it between the claim and the record
+				UE_LOG(LogEasySynth, Warning, TEXT("%s: Shard %s made no progress for %.0fs, stopping worker %u"),
+					*FString(__FUNCTION__), *Shard.id, SecondsSinceHeartbeat, Shard.worker_pid)
+				if (Worker != nullptr)
+				{
+					const bool bKillTree = true;
+					FPlatformProcess::TerminateProc(*Worker, bKillTree);
+				}
+				else
+				{
+					ShardWorkQueue.Requeue(Shard, MaxShardAttempts);
+				}
+			}
+		}
+
+		// Running workers claim the remaining shards, new ones replace workers that exited
+		const int32 NumPendingShards = ShardWorkQueue.NumPendingShards();
+		while (Workers.Num() < FMath::Min(NumWorkers, NumPendingShards) && NumWorkerLaunchesLeft > 0)
+		{
+			LaunchShardWorker(WorkerParams, Workers);
+			NumWorkerLaunchesLeft--;
+		}
+
+		if (Workers.Num() == 0)
+		{
+			break;
+		}
+	}
+
+	// Shards left behind by failed or crashed workers are kept for inspection
+	const TArray<FString> UnfinishedShardIds = ShardWorkQueue.UnfinishedShardIds();
+	if (UnfinishedShardIds.Num() > 0)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Shards not rendered: %s"),
+			*FString(__FUNCTION__), *FString::Join(UnfinishedShardIds, TEXT(", ")))
+		return ExitCodeFailure;
+	}
+
+	// Merge shard outputs of each sequence in the frame order
+	const bool bRequireExists = false;
+	const bool bTree = true;
+	for (const FString& LevelSequencePath : JobSpec.level_sequences)
+	{
+		const TArray<FRenderShard> SequenceShards = Shards.FilterByPredicate(
+			[&LevelSequencePath](const FRenderShard& Shard) { return Shard.level_sequence == LevelSequencePath; });
+		const FString OutputDirectory = SequenceOutputDir(JobSpec, LevelSequencePath);
+		if (!MergeShardOutputs(OutputDirectory, SequenceShards))
+		{
+			return ExitCodeFailure;
+		}
+		IFileManager::Get().DeleteDirectory(*FPathUtils::ShardsDir(OutputDirectory), bRequireExists, bTree);
+	}
+	IFileManager::Get().DeleteDirectory(*FPathUtils::ShardsDir(JobSpec.output_dir), bRequireExists, bTree);
+
+	return ExitCodeSuccess;
+}
+
+int32 UEasySynthRenderCommandlet::RunShardWorker(
+	USequenceRenderer* SequenceRenderer,
+	const FRenderJobSpec& JobSpec,
+	const FRendererTargetOptions& TargetOptions,
+	const FString& ShardQueueDir)
+{
+	const FIntPoint OutputResolution(JobSpec.resolution[0], JobSpec.resolution[1]);
+	FShardWorkQueue ShardWorkQueue(ShardQueueDir);
+
+	// Shard outputs are merged as loose files, so they are never packed into dataset shards
+	FRendererTargetOptions WorkerTargetOptions = TargetOptions;
+	WorkerTargetOptions.SetDatasetShardSizeMegabytes(0);
+	int32 NumFailedShards = 0;
+
+	FRenderShard Shard;
+	while (ShardWorkQueue.Claim(Shard))
+	{
+		UE_LOG(LogEasySynth, Log, TEXT("%s: Rendering shard %s, frames [%d, %d)"),
+			*FString(__FUNCTION__), *Shard.id, Shard.start_frame, Shard.end_frame)
+
+		// Rendering progress keeps the shard alive, so that the coordinator does not stop this worker
+		ActiveShardWorkQueue = &ShardWorkQueue;
+		ActiveShard = Shard;
+		HeartbeatFramesCompleted = 0;
+
+		SequenceRenderer->SetFrameRange(TRange<int32>(Shard.start_frame, Shard.end_frame));
+		const bool bSuccess = RenderLevelSequence(
+			SequenceRenderer,
+			Shard.level_sequence,
+			WorkerTargetOptions,
+			OutputResolution,
+			Shard.output_dir);
+		if (!bSuccess)
+		{
+			NumFailedShards++;
+		}
+
+		ActiveShardWorkQueue = nullptr;
+		ShardWorkQueue.Complete(Shard, bSuccess);
+	}
+
+	return (NumFailedShards == 0) ? ExitCodeSuccess : ExitCodeFailure;
+}
+
+void UEasySynthRenderCommandlet::LaunchShardWorker(const FString& WorkerParams, TMap<uint32, FProcHandle>& Workers)
+{
+	const bool bLaunchDetached = false;
+	const bool bLaunchHidden = true;
+	const bool bLaunchReallyHidden = true;
+	uint32 WorkerPid = 0;
+	FProcHandle Worker = FPlatformProcess::CreateProc(
+		FPlatformProcess::ExecutablePath(),
+		*WorkerParams,
+		bLaunchDetached,
+		bLaunchHidden,
+		bLaunchReallyHidden,
+		&WorkerPid,
+		0,
+		nullptr,
+		nullptr);
+	if (!Worker.IsValid())
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not launch a worker"), *FString(__FUNCTION__))
+		return;
+	}
+	Workers.Add(WorkerPid, Worker);
+}
+
+bool UEasySynthRenderCommandlet::RenderLevelSequence(
+	USequenceRenderer* SequenceRenderer,
+	const FString& LevelSequencePath,
+	const FRendererTargetOptions& TargetOptions,
+	const FIntPoint& OutputResolution,
+	const FString& OutputDirectory)
+{
+	ULevelSequence* LevelSequence = LoadObject<ULevelSequence>(nullptr, *LevelSequencePath);
+	if (LevelSequence == nullptr)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not load the level sequence %s"),
+			*FString(__FUNCTION__), *LevelSequencePath)
+		return false;
+	}
+
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Rendering %s into %s"),
+		*FString(__FUNCTION__), *LevelSequencePath, *OutputDirectory)
+
+	bRenderingSucceeded = false;
+	if (!SequenceRenderer->RenderSequence(
+		FAssetData(LevelSequence),
+		TargetOptions,
+		OutputResolution,
+		OutputDirectory))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not start rendering %s: %s"),
+			*FString(__FUNCTION__), *LevelSequencePath, *SequenceRenderer->GetErrorMessage())
+		return false;
+	}
+
+	TickUntilRenderingFinished(SequenceRenderer);
+
+	if (!bRenderingSucceeded)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Rendering %s failed: %s"),
+			*FString(__FUNCTION__), *LevelSequencePath, *SequenceRenderer->GetErrorMessage())
+	}
+	return bRenderingSucceeded;
+}
+
+void UEasySynthRenderCommandlet::OnRenderProgress(const FRenderProgress& Progress)
+{
+	if (ActiveShardWorkQueue != nullptr && Progress.FramesCompleted != HeartbeatFramesCompleted)
+	{
+		ActiveShardWorkQueue->Heartbeat(ActiveShard);
+		HeartbeatFramesCompleted = Progress.FramesCompleted;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	if (CurrentTime - LastProgressLogTime < ProgressLogIntervalSeconds)
+	{
+		return;
+	}
+	LastProgressLogTime = CurrentTime;
+
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Progress: %s"), *FString(__FUNCTION__), *Progress.ToString())
+}
+
+bool UEasySynthRenderCommandlet::LoadJobSpec(const FString& SpecFilePath, FRenderJobSpec& OutJobSpec)
+{
+	// Read the spec file
+	FString FileContent;
+	if (!FFileHelper::LoadFileToString(FileContent, *SpecFilePath))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed to open the job spec file %s"), *FString(__FUNCTION__), *SpecFilePath)
+		return false;
+	}
+
+	// Parse JSON content into equivalent structure
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct(FileContent, &OutJobSpec, 0, 0))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Invalid job spec file content"), *FString(__FUNCTION__))
+		return false;
+	}
+
+	if (OutJobSpec.level_sequences.Num() == 0)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: No level sequences provided"), *FString(__FUNCTION__))
+		return false;
+	}
+
+	if (OutJobSpec.resolution.Num() != 2 || OutJobSpec.resolution[0] <= 0 || OutJobSpec.resolution[1] <= 0)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Expected 2 positive values for the resolution"), *FString(__FUNCTION__))
+		return false;
+	}
+
+	if (OutJobSpec.output_dir.IsEmpty())
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: No output directory provided"), *FString(__FUNCTION__))
+		return false;
+	}
+
+	return true;
+}
+
+FString UEasySynthRenderCommandlet::SequenceOutputDir(const FRenderJobSpec& JobSpec, const FString& LevelSequencePath)
+{
+	// Keep outputs of different sequences apart
+	if (JobSpec.level_sequences.Num() > 1)
+	{
+		return JobSpec.output_dir / FPaths::GetBaseFilename(LevelSequencePath);
+	}
+	return JobSpec.output_dir;
+}
+
+bool UEasySynthRenderCommandlet::GetSequenceFrameRange(const FString& LevelSequencePath, TRange<int32>& OutFrameRange)
+{
+	ULevelSequence* LevelSequence = LoadObject<ULevelSequence>(nullptr, *LevelSequencePath);
+	if (LevelSequence == nullptr)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not load the level sequence %s"),
+			*FString(__FUNCTION__), *LevelSequencePath)
+		return false;
+	}
+
+	OutFrameRange = FSequencerWrapper::PlaybackFrameRange(LevelSequence);
+	if (OutFrameRange.IsEmpty())
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Level sequence %s has an empty playback range"),
+			*FString(__FUNCTION__), *LevelSequencePath)
+		return false;
+	}
+
+	return true;
+}
+
+bool UEasySynthRenderCommandlet::MergeShardOutputs(const FString& OutputDirectory, const TArray<FRenderShard>& Shards)
+{
+	// Camera pose and IMU files of all shards, appended in the frame order
+	TMap<FString, TArray<FString>> MergedPoseFiles;
+
+	// NumPy arrays hold frames as their first dimension, so shard files are concatenated along it
+	TMap<FString, TArray<FString>> MergedNpyFiles;
+
+	// Render manifests of all shards, without the complete markers, as they only cover the range of their shard
+	TMap<FString, TArray<FString>> MergedManifestFiles;
+
+	// Timing reports of all shards, whose stage samples are added up
+	TMap<FString, TArray<FString>> MergedTimingsFiles;
+
+	for (const FRenderShard& Shard : Shards)
+	{
+		TArray<FString> ShardFiles;
+		const bool bFiles = true;
+		const bool bDirectories = false;
+		IFileManager::Get().FindFilesRecursive(ShardFiles, *Shard.output_dir, TEXT("*"), bFiles, bDirectories);
+
+		for (const FString& ShardFile : ShardFiles)
+		{
+			FString RelativePath = ShardFile;
+			FPaths::MakePathRelativeTo(RelativePath, *(Shard.output_dir / TEXT("")));
+			const FString MergedFile = OutputDirectory / RelativePath;
+
+			const bool bPoseFile = FPaths::GetCleanFilename(ShardFile) == FPathUtils::CameraPosesFileName;
+			const bool bImuFile = FPaths::GetCleanFilename(ShardFile) == FPathUtils::ImuFileName;
+			if (FPaths::GetExtension(ShardFile) == TEXT("npy"))
+			{
+				MergedNpyFiles.FindOrAdd(MergedFile).Add(ShardFile);
+				continue;
+			}
+			if (FPaths::GetCleanFilename(ShardFile) == FPathUtils::TimingsFileName)
+			{
+				MergedTimingsFiles.FindOrAdd(FPaths::GetPath(MergedFile)).Add(ShardFile);
+				continue;
+			}
+			if (FPaths::GetCleanFilename(ShardFile) == FRenderManifest::ManifestFileName)
+			{
+				TArray<FString> ManifestLines;
+				if (!FFileHelper::LoadFileToStringArray(ManifestLines, *ShardFile))
+				{
+					UE_LOG(LogEasySynth, Error, TEXT("%s: Could not read %s"), *FString(__FUNCTION__), *ShardFile)
+					return false;
+				}
+				TArray<FString>& MergedLines = MergedManifestFiles.FindOrAdd(MergedFile);
+				for (const FString& ManifestLine : ManifestLines)
+				{
+					if (!ManifestLine.EndsWith(TEXT(",") + FRenderManifest::CompleteMarker))
+					{
+						MergedLines.Add(ManifestLine);
+					}
+				}
+				continue;
+			}
+			if (!bPoseFile && !bImuFile)
+			{
+				// Image files already carry sequence frame numbers, shared files are identical in all shards
+				const bool bReplace = true;
+				if (!IFileManager::Get().Move(*MergedFile, *ShardFile, bReplace))
+				{
+					UE_LOG(LogEasySynth, Error, TEXT("%s: Could not move %s to %s"),
+						*FString(__FUNCTION__), *ShardFile, *MergedFile)
+					return false;
+				}
+				continue;
+			}
+
+			TArray<FString> Lines;
+			if (!FFileHelper::LoadFileToStringArray(Lines, *ShardFile) || Lines.Num() == 0)
+			{
+				UE_LOG(LogEasySynth, Error, TEXT("%s: Could not read %s"), *FString(__FUNCTION__), *ShardFile)
+				return false;
+			}
+
+			// Keep a single header and renumber pose ids so they continue from the previous shard,
+			// IMU samples have no ids and are appended as they are
+			TArray<FString>& MergedLines = MergedPoseFiles.FindOrAdd(MergedFile);
+			if (MergedLines.Num() == 0)
+			{
+				MergedLines.Add(Lines[0]);
+			}
+			if (bImuFile)
+			{
+				MergedLines.Append(&Lines[1], Lines.Num() - 1);
+				continue;
+			}
+			for (int i = 1; i < Lines.Num(); i++)
+			{
+				FString PoseId;
+				FString PoseValues;
+				if (Lines[i].Split(TEXT(","), &PoseId, &PoseValues))
+				{
+					MergedLines.Add(FString::Printf(TEXT("%d,%s"), MergedLines.Num() - 1, *PoseValues));
+				}
+			}
+		}
+	}
+
+	for (const TPair<FString, TArray<FString>>& MergedPoseFile : MergedPoseFiles)
+	{
+		if (!FFileHelper::SaveStringArrayToFile(MergedPoseFile.Value, *MergedPoseFile.Key))
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving the file %s"),
+				*FString(__FUNCTION__), *MergedPoseFile.Key)
+			return false;
+		}
+	}
+
+	for (const TPair<FString, TArray<FString>>& MergedNpyFile : MergedNpyFiles)
+	{
+		if (!FNpyFile::Concatenate(MergedNpyFile.Value, MergedNpyFile.Key))
+		{
+			return false;
+		}
+	}
+
+	for (const TPair<FString, TArray<FString>>& MergedManifestFile : MergedManifestFiles)
+	{
+		if (!FFileHelper::SaveStringArrayToFile(MergedManifestFile.Value, *MergedManifestFile.Key))
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving the file %s"),
+				*FString(__FUNCTION__), *MergedManifestFile.Key)
+			return false;
+		}
+	}
+
+	for (const TPair<FString, TArray<FString>>& MergedTimingsFile : MergedTimingsFiles)
+	{
+		if (!FRenderTelemetry::MergeTimings(MergedTimingsFile.Value, MergedTimingsFile.Key))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UEasySynthRenderCommandlet::TickUntilRenderingFinished(USequenceRenderer* SequenceRenderer)
+{
+	// Commandlets do not run the engine loop, so tick the editor manually
+	// to let timers and the movie pipeline executor progress
+	double LastTime = FPlatformTime::Seconds();
+	while ((SequenceRenderer->IsRendering() || SequenceRenderer->IsProcessingQueue()) && !IsEngineExitRequested())
+	{
+		const double CurrentTime = FPlatformTime::Seconds();
+		const float DeltaSeconds = CurrentTime - LastTime;
+		LastTime = CurrentTime;
+
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		FTSTicker::GetCoreTicker().Tick(DeltaSeconds);
+		GEngine->Tick(DeltaSeconds, false);
+		GFrameCounter++;
+
+		FPlatformProcess::Sleep(0.0f);
+	}
+}
@@ -0,0 +1,192 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "Commandlets/ShardWorkQueue.h"
+
+#include "HAL/FileManager.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+
+#include "EasySynth.h"
+
+
+const FString FShardWorkQueue::PendingDirName(TEXT("Pending"));
+const FString FShardWorkQueue::ClaimedDirName(TEXT("Claimed"));
+const FString FShardWorkQueue::DoneDirName(TEXT("Done"));
+const FString FShardWorkQueue::FailedDirName(TEXT("Failed"));
+
+bool FShardWorkQueue::Create(const TArray<FRenderShard>& Shards)
+{
+	// Remove leftovers of a previous queue
+	const bool bRequireExists = false;
+	const bool bTree = true;
+	IFileManager::Get().DeleteDirectory(*QueueDir, bRequireExists, bTree);
+
+	for (const FString& StateDirName : { PendingDirName, ClaimedDirName, DoneDirName, FailedDirName })
+	{
+		if (!IFileManager::Get().MakeDirectory(*(QueueDir / StateDirName), bTree))
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Could not create the queue directory %s"),
+				*FString(__FUNCTION__), *(QueueDir / StateDirName))
+			return false;
+		}
+	}
+
+	for (const FRenderShard& Shard : Shards)
+	{
+		if (!SaveShard(ShardFilePath(PendingDirName, Shard.id), Shard))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FShardWorkQueue::Claim(FRenderShard& OutShard)
+{
+	// Other processes may claim the same shard in the meantime,
+	// in which case the rename fails and the next shard is tried
+	for (const FString& ShardId : ShardIds(PendingDirName))
+	{
+		// Renaming keeps the time stamp of the pending file, which may be older than the worker timeout,
+		// so it is refreshed first, keeping the coordinator from requeueing the shard before its process is recorded
+		IFileManager::Get().SetTimeStamp(*ShardFilePath(PendingDirName, ShardId), FDateTime::UtcNow());
+		if (!MoveShard(ShardId, PendingDirName, ClaimedDirName))
+		{
+			continue;
+		}
+
+		const FString FilePath = ShardFilePath(ClaimedDirName, ShardId);
+		if (!LoadShard(FilePath, OutShard))
+		{
+			MoveShard(ShardId, ClaimedDirName, FailedDirName);
+			continue;
+		}
+
+		// Record the claiming process, so that the shard can be requeued if the process exits
+		OutShard.worker_pid = FPlatformProcess::GetCurrentProcessId();
+		SaveShard(FilePath, OutShard);
+
+		return true;
+	}
+
+	return false;
+}
+
+bool FShardWorkQueue::Complete(const FRenderShard& Shard, const bool bSuccess)
+{
+	return MoveShard(Shard.id, ClaimedDirName, bSuccess ? DoneDirName : FailedDirName);
+}
+
+void FShardWorkQueue::Heartbeat(const FRenderShard& Shard) const
+{
+	IFileManager::Get().SetTimeStamp(*ShardFilePath(ClaimedDirName, Shard.id), FDateTime::UtcNow());
+}
+
+double FShardWorkQueue::SecondsSinceHeartbeat(const FRenderShard& Shard) const
+{
+	const FDateTime HeartbeatTime = IFileManager::Get().GetTimeStamp(*ShardFilePath(ClaimedDirName, Shard.id));
+	return (FDateTime::UtcNow() - HeartbeatTime).GetTotalSeconds();
+}
+
+bool FShardWorkQueue::Requeue(const FRenderShard& Shard, const int32 MaxAttempts)
+{
+	FRenderShard RequeuedShard = Shard;
+	RequeuedShard.worker_pid = 0;
+	RequeuedShard.attempts++;
+	if (!SaveShard(ShardFilePath(ClaimedDirName, Shard.id), RequeuedShard))
+	{
+		return false;
+	}
+
+	if (RequeuedShard.attempts >= MaxAttempts)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Shard %s failed after %d attempts"),
+			*FString(__FUNCTION__), *Shard.id, RequeuedShard.attempts)
+		return MoveShard(Shard.id, ClaimedDirName, FailedDirName);
+	}
+	return MoveShard(Shard.id, ClaimedDirName, PendingDirName);
+}
+
+TArray<FRenderShard> FShardWorkQueue::ClaimedShards() const
+{
+	TArray<FRenderShard> Shards;
+	for (const FString& ShardId : ShardIds(ClaimedDirName))
+	{
+		// The shard may be completed by its process in the meantime
+		FRenderShard Shard;
+		if (LoadShard(ShardFilePath(ClaimedDirName, ShardId), Shard))
+		{
+			Shards.Add(Shard);
+		}
+	}
+	return Shards;
+}
+
+TArray<FString> FShardWorkQueue::UnfinishedShardIds() const
+{
+	TArray<FString> UnfinishedIds = ShardIds(PendingDirName);
+	UnfinishedIds.Append(ShardIds(ClaimedDirName));
+	UnfinishedIds.Append(ShardIds(FailedDirName));
+	UnfinishedIds.Sort();
+	return UnfinishedIds;
+}
+
+FString FShardWorkQueue::ShardFilePath(const FString& StateDirName, const FString& ShardId) const
+{
+	return QueueDir / StateDirName / ShardId + TEXT(".json");
+}
+
+bool FShardWorkQueue::MoveShard(const FString& ShardId, const FString& FromDirName, const FString& ToDirName) const
+{
+	// A plain rename within the same file system is atomic, so only a single process can succeed
+	const bool bReplace = false;
+	const bool bEvenIfReadOnly = false;
+	const bool bAttributes = false;
+	const bool bDoNotRetryOrError = true;
+	return IFileManager::Get().Move(
+		*ShardFilePath(ToDirName, ShardId),
+		*ShardFilePath(FromDirName, ShardId),
+		bReplace,
+		bEvenIfReadOnly,
+		bAttributes,
+		bDoNotRetryOrError);
+}
+
+bool FShardWorkQueue::LoadShard(const FString& FilePath, FRenderShard& OutShard)
+{
+	FString FileContent;
+	if (!FFileHelper::LoadFileToString(FileContent, *FilePath) ||
+		!FJsonObjectConverter::JsonObjectStringToUStruct(FileContent, &OutShard, 0, 0))
+	{
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: Could not read the shard file %s"), *FString(__FUNCTION__), *FilePath)
+		return false;
+	}
+	return true;
+}
+
+bool FShardWorkQueue::SaveShard(const FString& FilePath, const FRenderShard& Shard)
+{
+	FString JsonString;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Shard, JsonString) ||
+		!FFileHelper::SaveStringToFile(JsonString, *FilePath))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving the file %s"), *FString(__FUNCTION__), *FilePath)
+		return false;
+	}
+	return true;
+}
+
+TArray<FString> FShardWorkQueue::ShardIds(const FString& StateDirName) const
+{
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *(QueueDir / StateDirName), TEXT("json"));
+
+	TArray<FString> Ids;
+	for (const FString& FileName : FileNames)
+	{
+		Ids.Add(FPaths::GetBaseFilename(FileName));
+	}
+	Ids.Sort();
+	return Ids;
+}
@@ -0,0 +1,281 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "DatasetShardPacker.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+#include "EasySynth.h"
+#include "RenderManifest.h"
+
+
+static TAutoConsoleVariable<int32> CVarDatasetShardPendingMegabytes(
+	TEXT("EasySynth.DatasetShardPendingMegabytes"),
+	2048,
+	TEXT("Size of rendered images kept in memory while their dataset samples wait for images of other targets.\n")
+	TEXT("Images beyond it are written into their files and read back once their sample is complete."),
+	ECVF_Default);
+
+TSharedPtr<FDatasetShardPacker> FDatasetShardPacker::ActivePacker;
+FCriticalSection FDatasetShardPacker::ActivePackerCriticalSection;
+
+FDatasetShardPacker::FDatasetShardPacker(const FString& ShardDirectory, const int64 MaxShardBytes) :
+	ShardDirectory(ShardDirectory),
+	MaxShardBytes(MaxShardBytes),
+	MaxPendingBytes(int64(FMath::Max(0, CVarDatasetShardPendingMegabytes.GetValueOnAnyThread())) * 1024 * 1024),
+	bResume(false),
+	PendingBytes(0),
+	NumSamples(0)
+{}
+
+void FDatasetShardPacker::Open(const bool bResume)
+{
+	this->bResume = bResume;
+	if (!bResume)
+	{
+		const bool bRequireExists = false;
+		const bool bTree = true;
+		IFileManager::Get().DeleteDirectory(*ShardDirectory, bRequireExists, bTree);
+	}
+}
+
+bool FDatasetShardPacker::AddCamera(
+	const FString& RigCameraDir,
+	const FString& CameraName,
+	const FString& PosesFilePath,
+	const TArray<int32>& PoseFrameNumbers)
+{
+	FPackedCamera& Camera = Cameras.Add(FPaths::ConvertRelativePathToFull(RigCameraDir));
+	Camera.CameraName = CameraName;
+	if (PosesFilePath.IsEmpty())
+	{
+		return true;
+	}
+
+	TArray<FString> PoseLines;
+	if (!FFileHelper::LoadFileToStringArray(PoseLines, *PosesFilePath) || PoseLines.Num() == 0)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not read the camera poses file %s"), *FString(__FUNCTION__), *PosesFilePath)
+		return false;
+	}
+	if (PoseLines.Num() - 1 != PoseFrameNumbers.Num())
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Camera poses file %s has %d rows, while poses of %d frames were exported"),
+			*FString(__FUNCTION__), *PosesFilePath, PoseLines.Num() - 1, PoseFrameNumbers.Num())
+		return false;
+	}
+
+	// Rows follow the header line in the order of the exported frames, which may skip frames between camera cuts
+	Camera.PoseHeader = PoseLines[0];
+	for (int32 i = 0; i < PoseFrameNumbers.Num(); i++)
+	{
+		Camera.FramePoses.Add(PoseFrameNumbers[i], PoseLines[i + 1]);
+	}
+	return true;
+}
+
+void FDatasetShardPacker::AddTarget(const TArray<FString>& TargetOutputNames)
+{
+	OutputNames.Append(TargetOutputNames);
+}
+
+bool FDatasetShardPacker::AcceptsImage(const FString& FilePath) const
+{
+	FString OutputName;
+	int32 FrameNumber;
+	return FindImageCamera(FilePath, OutputName, FrameNumber) != nullptr;
+}
+
+bool FDatasetShardPacker::AddImage(const FString& FilePath, TArray64<uint8>&& Data)
+{
+	FString OutputName;
+	int32 FrameNumber;
+	const FPackedCamera* Camera = FindImageCamera(FilePath, OutputName, FrameNumber);
+	if (Camera == nullptr)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Image %s does not belong to a packed camera and output"),
+			*FString(__FUNCTION__), *FilePath)
+		return false;
+	}
+
+	// The image is recorded as rendered once it is received, as it is either packed or written into its file
+	FRenderManifest::AddWrittenFile(FilePath, Data.Num());
+
+	FScopeLock Lock(&CriticalSection);
+
+	const FString PendingKey = FString::Printf(TEXT("%s/%d"), *Camera->CameraName, FrameNumber);
+	FPendingSample& Sample = PendingSamples.FindOrAdd(PendingKey);
+	const bool bSampleComplete = (Sample.NumImages() + 1 >= OutputNames.Num());
+	if (!bSampleComplete && PendingBytes + Data.Num() > MaxPendingBytes)
+	{
+		if (!FFileHelper::SaveArrayToFile(Data, *FilePath))
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving the file %s"), *FString(__FUNCTION__), *FilePath)
+			return false;
+		}
+		Sample.WrittenFilePaths.Add(FilePath);
+		return true;
+	}
+
+	FDatasetSampleMember& Member = Sample.Members.AddDefaulted_GetRef();
+	Member.Extension = OutputName + TEXT(".") + FPaths::GetExtension(FilePath);
+	Member.Data = MoveTemp(Data);
+	Sample.FilePaths.Add(FilePath);
+	PendingBytes += Member.Data.Num();
+	if (!bSampleComplete)
+	{
+		return true;
+	}
+
+	// Images that did not fit into the memory budget are read back from their files
+	for (const FString& WrittenFilePath : Sample.WrittenFilePaths)
+	{
+		FDatasetSampleMember& WrittenMember = Sample.Members.AddDefaulted_GetRef();
+		WrittenMember.Extension = FPaths::GetCleanFilename(FPaths::GetPath(WrittenFilePath)) +
+			TEXT(".") + FPaths::GetExtension(WrittenFilePath);
+		if (!FFileHelper::LoadFileToArray(WrittenMember.Data, *WrittenFilePath))
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Could not read the image %s"), *FString(__FUNCTION__), *WrittenFilePath)
+			return false;
+		}
+	}
+
+	for (int32 i = 0; i < Sample.FilePaths.Num(); i++)
+	{
+		PendingBytes -= Sample.Members[i].Data.Num();
+	}
+	if (!AppendSample(*Camera, FrameNumber, Sample))
+	{
+		return false;
+	}
+
+	// Files are only removed once their sample is in the shard
+	for (const FString& WrittenFilePath : Sample.WrittenFilePaths)
+	{
+		IFileManager::Get().Delete(*WrittenFilePath);
+	}
+	PendingSamples.Remove(PendingKey);
+
+	return true;
+}
+
+bool FDatasetShardPacker::Close()
+{
+	FScopeLock Lock(&CriticalSection);
+
+	bool bClosed = true;
+	if (PendingSamples.Num() > 0)
+	{
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: Images of %d samples with missing outputs are written as separate files"),
+			*FString(__FUNCTION__), PendingSamples.Num())
+		for (TPair<FString, FPendingSample>& PendingSample : PendingSamples)
+		{
+			const FPendingSample& Sample = PendingSample.Value;
+			for (int32 i = 0; i < Sample.FilePaths.Num(); i++)
+			{
+				if (!FFileHelper::SaveArrayToFile(Sample.Members[i].Data, *Sample.FilePaths[i]))
+				{
+					UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving the file %s"),
+						*FString(__FUNCTION__), *Sample.FilePaths[i])
+					bClosed = false;
+				}
+			}
+		}
+		PendingSamples.Empty();
+		PendingBytes = 0;
+	}
+
+	int32 NumShards = 0;
+	if (Writer.IsValid())
+	{
+		if (!Writer->Close())
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Could not finish the dataset shard"), *FString(__FUNCTION__))
+			bClosed = false;
+		}
+		NumShards = Writer->NumShards();
+		Writer.Reset();
+	}
+
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Packed %d samples into %d dataset shards"),
+		*FString(__FUNCTION__), NumSamples, NumShards)
+
+	return bClosed;
+}
+
+void FDatasetShardPacker::SetActive(const TSharedPtr<FDatasetShardPacker>& Packer)
+{
+	FScopeLock Lock(&ActivePackerCriticalSection);
+	ActivePacker = Packer;
+}
+
+bool FDatasetShardPacker::IsPacked(const FString& FilePath)
+{
+	FScopeLock Lock(&ActivePackerCriticalSection);
+	return ActivePacker.IsValid() && ActivePacker->AcceptsImage(FilePath);
+}
+
+bool FDatasetShardPacker::PackImage(const FString& FilePath, TArray64<uint8>&& Data)
+{
+	TSharedPtr<FDatasetShardPacker> Packer;
+	{
+		FScopeLock Lock(&ActivePackerCriticalSection);
+		Packer = ActivePacker;
+	}
+	if (Packer.IsValid())
+	{
+		return Packer->AddImage(FilePath, MoveTemp(Data));
+	}
+
+	// The packer was stopped after the image was encoded for it
+	FRenderManifest::AddWrittenFile(FilePath, Data.Num());
+	return FFileHelper::SaveArrayToFile(Data, *FilePath);
+}
+
+const FDatasetShardPacker::FPackedCamera* FDatasetShardPacker::FindImageCamera(
+	const FString& FilePath,
+	FString& OutOutputName,
+	int32& OutFrameNumber) const
+{
+	// Images are written to the <rig camera dir>/<output name> directory, other files are not packed
+	const FString OutputDirectory = FPaths::GetPath(FilePath);
+	OutOutputName = FPaths::GetCleanFilename(OutputDirectory);
+	if (!OutputNames.Contains(OutOutputName) || !FRenderManifest::ParseFrameNumber(FilePath, OutFrameNumber))
+	{
+		return nullptr;
+	}
+	return Cameras.Find(FPaths::ConvertRelativePathToFull(FPaths::GetPath(OutputDirectory)));
+}
+
+bool FDatasetShardPacker::AppendSample(const FPackedCamera& Camera, const int32 FrameNumber, FPendingSample& Sample)
+{
+	if (!Writer.IsValid())
+	{
+		const int32 FirstShardIndex = bResume ? FDatasetShardWriter::NextShardIndex(ShardDirectory) : 0;
+		Writer = MakeUnique<FDatasetShardWriter>(ShardDirectory, MaxShardBytes, FirstShardIndex);
+	}
+
+	const FString* PoseRow = Camera.FramePoses.Find(FrameNumber);
+	if (PoseRow != nullptr)
+	{
+		const FString PoseContent = Camera.PoseHeader + TEXT("\n") + *PoseRow + TEXT("\n");
+		const FTCHARToUTF8 PoseContentUtf8(*PoseContent);
+		FDatasetSampleMember& Member = Sample.Members.AddDefaulted_GetRef();
+		Member.Extension = TEXT("pose.csv");
+		Member.Data.Append(reinterpret_cast<const uint8*>(PoseContentUtf8.Get()), PoseContentUtf8.Length());
+	}
+
+	const FString SampleKey = FString::Printf(TEXT("%s/%06d"), *Camera.CameraName, FrameNumber);
+	if (!Writer->AddSample(SampleKey, Sample.Members))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not write the sample %s into the dataset shard"),
+			*FString(__FUNCTION__), *SampleKey)
+		return false;
+	}
+
+	NumSamples++;
+	return true;
+}
@@ -0,0 +1,222 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "DatasetShardWriter.h"
+
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Paths.h"
+
+#include "EasySynth.h"
+
+
+const FString FDatasetShardWriter::TemporaryExtension(TEXT(".tmp"));
+
+FDatasetShardWriter::FDatasetShardWriter(const FString& ShardDirectory, const int64 MaxShardBytes, const int32 FirstShardIndex) :
+	ShardDirectory(ShardDirectory),
+	MaxShardBytes(MaxShardBytes),
+	FirstShardIndex(FirstShardIndex),
+	ShardIndex(FirstShardIndex - 1),
+	ShardBytes(0),
+	SampleCount(0),
+	bFailed(false)
+{}
+
+FDatasetShardWriter::~FDatasetShardWriter()
+{
+	Close();
+}
+
+bool FDatasetShardWriter::AddSample(const FString& Key, const TArray<FDatasetSampleMember>& Members)
+{
+	if (bFailed)
+	{
+		return false;
+	}
+
+	// Samples are never split between shards, so a shard may exceed the maximum size by a single sample
+	if (!ShardFile.IsValid() || ShardBytes >= MaxShardBytes)
+	{
+		if (!StartNextShard())
+		{
+			return false;
+		}
+	}
+
+	for (const FDatasetSampleMember& Member : Members)
+	{
+		if (!WriteMember(Key + TEXT(".") + Member.Extension, Member.Data))
+		{
+			return false;
+		}
+	}
+
+	SampleCount++;
+	return true;
+}
+
+bool FDatasetShardWriter::Close()
+{
+	if (ShardFile.IsValid())
+	{
+		// The archive ends with two zero blocks
+		TArray<uint8> EndBlocks;
+		EndBlocks.SetNumZeroed(2 * TarBlockSize);
+		Write(EndBlocks.GetData(), EndBlocks.Num());
+		if (!ShardFile->Flush())
+		{
+			bFailed = true;
+		}
+		ShardFile.Reset();
+
+		// A failed shard keeps its temporary name, as it may be missing samples or its end blocks
+		const FString ShardFilePath = ShardDirectory / ShardFileName(ShardIndex);
+		const bool bReplace = true;
+		if (!bFailed && !IFileManager::Get().Move(*ShardFilePath, *TemporaryShardFilePath(ShardIndex), bReplace))
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Could not rename the finished shard to %s"), *FString(__FUNCTION__), *ShardFilePath)
+			bFailed = true;
+		}
+	}
+	return !bFailed;
+}
+
+FString FDatasetShardWriter::ShardFileName(const int32 Index)
+{
+	return FString::Printf(TEXT("shard-%06d.tar"), Index);
+}
+
+int32 FDatasetShardWriter::NextShardIndex(const FString& ShardDirectory)
+{
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *(ShardDirectory / TEXT("shard-*.tar")), true, false);
+	int32 NextIndex = 0;
+	for (const FString& FileName : FileNames)
+	{
+		const FString IndexString = FPaths::GetBaseFilename(FileName).RightChop(6);
+		if (IndexString.IsNumeric())
+		{
+			NextIndex = FMath::Max(NextIndex, FCString::Atoi(*IndexString) + 1);
+		}
+	}
+	return NextIndex;
+}
+
+bool FDatasetShardWriter::StartNextShard()
+{
+	if (!Close())
+	{
+		return false;
+	}
+
+	ShardIndex++;
+	ShardBytes = 0;
+
+	const FString ShardFilePath = TemporaryShardFilePath(ShardIndex);
+	const bool bTree = true;
+	IFileManager::Get().MakeDirectory(*ShardDirectory, bTree);
+	ShardFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*ShardFilePath));
+	if (!ShardFile.IsValid())
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not open the shard file %s"), *FString(__FUNCTION__), *ShardFilePath)
+		bFailed = true;
+		return false;
+	}
+
+	return true;
+}
+
+bool FDatasetShardWriter::WriteMember(const FString& MemberName, const TArray64<uint8>& Data)
+{
+	uint8 Header[TarBlockSize];
+	if (!FillHeader(MemberName, Data.Num(), Header))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Member name %s is too long for a tar header"),
+			*FString(__FUNCTION__), *MemberName)
+		bFailed = true;
+		return false;
+	}
+
+	// File content is padded to the block size
+	const int64 PaddingSize = (TarBlockSize - Data.Num() % TarBlockSize) % TarBlockSize;
+	uint8 Padding[TarBlockSize] = {};
+	return Write(Header, TarBlockSize) && Write(Data.GetData(), Data.Num()) && Write(Padding, PaddingSize);
+}
+
+bool FDatasetShardWriter::Write(const uint8* Data, const int64 NumBytes)
+{
+	if (bFailed || !ShardFile.IsValid())
+	{
+		return false;
+	}
+	if (NumBytes > 0 && !ShardFile->Write(Data, NumBytes))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while writing the shard %s"),
+			*FString(__FUNCTION__), *ShardFileName(ShardIndex))
+		bFailed = true;
+		return false;
+	}
+	ShardBytes += NumBytes;
+	return true;
+}
+
+bool FDatasetShardWriter::FillHeader(const FString& MemberName, const int64 FileSize, uint8* OutHeader)
+{
+	FMemory::Memzero(OutHeader, TarBlockSize);
+
+	// Names longer than the name field are split into the ustar prefix and name at a path separator
+	const FTCHARToUTF8 NameUtf8(*MemberName);
+	const int32 NameLength = NameUtf8.Length();
+	int32 SplitIndex = 0;
+	if (NameLength > 100)
+	{
+		SplitIndex = INDEX_NONE;
+		for (int32 i = NameLength - 1; i > 0; i--)
+		{
+			if (NameUtf8.Get()[i] == '/' && i <= 155 && NameLength - i - 1 <= 100)
+			{
+				SplitIndex = i;
+				break;
+			}
+		}
+		if (SplitIndex == INDEX_NONE)
+		{
+			return false;
+		}
+		FMemory::Memcpy(OutHeader + 345, NameUtf8.Get(), SplitIndex);
+		SplitIndex++;
+	}
+	FMemory::Memcpy(OutHeader, NameUtf8.Get() + SplitIndex, NameLength - SplitIndex);
+
+	WriteOctal(OutHeader + 100, 8, 0644);
+	WriteOctal(OutHeader + 108, 8, 0);
+	WriteOctal(OutHeader + 116, 8, 0);
+	WriteOctal(OutHeader + 124, 12, FileSize);
+	WriteOctal(OutHeader + 136, 12, FDateTime::UtcNow().ToUnixTimestamp());
+	OutHeader[156] = '0';
+	FMemory::Memcpy(OutHeader + 257, "ustar", 6);
+	FMemory::Memcpy(OutHeader + 263, "00", 2);
+
+	// The checksum is computed with the checksum field filled with spaces
+	FMemory::Memset(OutHeader + 148, ' ', 8);
+	int64 Checksum = 0;
+	for (int32 i = 0; i < TarBlockSize; i++)
+	{
+		Checksum += OutHeader[i];
+	}
+	WriteOctal(OutHeader + 148, 7, Checksum);
+
+	return true;
+}
+
+void FDatasetShardWriter::WriteOctal(uint8* Field, const int32 FieldSize, const int64 Value)
+{
+	// Digits are written from the end, so that the leading ones are zero padded
+	int64 RemainingValue = Value;
+	for (int32 i = FieldSize - 2; i >= 0; i--)
+	{
+		Field[i] = static_cast<uint8>('0' + (RemainingValue & 7));
+		RemainingValue >>= 3;
+	}
+	Field[FieldSize - 1] = 0;
+}
@@ -0,0 +1,62 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "EXROutput/ExrBufferPool.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "Math/Float16Color.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+
+TRACE_DECLARE_INT_COUNTER(EasySynthExrBufferPoolHits, TEXT("EasySynth/ExrBufferPoolHits"));
+TRACE_DECLARE_INT_COUNTER(EasySynthExrBufferPoolMisses, TEXT("EasySynth/ExrBufferPoolMisses"));
+TRACE_DECLARE_MEMORY_COUNTER(EasySynthExrBufferPoolRetainedBytes, TEXT("EasySynth/ExrBufferPoolRetainedBytes"));
+
+static TAutoConsoleVariable<int32> CVarExrBufferPoolMegabytes(
+	TEXT("EasySynth.ExrBufferPoolMegabytes"),
+	1024,
+	TEXT("Maximum size of buffers kept for reuse by EXR image writes, in megabytes.\n")
+	TEXT("0 disables the reuse."),
+	ECVF_Default);
+
+static FThreadSafeCounter64 RetainedBytes;
+
+void FExrBufferPools::RecordAcquire(const bool bHit)
+{
+	if (bHit)
+	{
+		TRACE_COUNTER_INCREMENT(EasySynthExrBufferPoolHits);
+	}
+	else
+	{
+		TRACE_COUNTER_INCREMENT(EasySynthExrBufferPoolMisses);
+	}
+}
+
+bool FExrBufferPools::TryRetain(const int64 NumBytes)
+{
+	const int64 MaxRetainedBytes = int64(CVarExrBufferPoolMegabytes.GetValueOnAnyThread()) * 1024 * 1024;
+	const int64 NewRetainedBytes = RetainedBytes.Add(NumBytes) + NumBytes;
+	if (NewRetainedBytes > MaxRetainedBytes)
+	{
+		RetainedBytes.Subtract(NumBytes);
+		return false;
+	}
+
+	TRACE_COUNTER_SET(EasySynthExrBufferPoolRetainedBytes, NewRetainedBytes);
+	return true;
+}
+
+void FExrBufferPools::Unretain(const int64 NumBytes)
+{
+	TRACE_COUNTER_SET(EasySynthExrBufferPoolRetainedBytes, RetainedBytes.Subtract(NumBytes) - NumBytes);
+}
+
+void FExrBufferPools::EmptyAll()
+{
+	// Element types of the write buffers and of the layer pixel data
+	TExrBufferPool<uint8>::Empty();
+	TExrBufferPool<FColor>::Empty();
+	TExrBufferPool<FFloat16Color>::Empty();
+	TExrBufferPool<FLinearColor>::Empty();
+}
@@ -0,0 +1,99 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeLock.h"
+
+
+/**
+ * Shared accounting of all EXR buffer pools
+ * Hits, misses and retained bytes are reported as EasySynth/ExrBufferPool* trace counters
+*/
+class FExrBufferPools
+{
+public:
+	/** Counts an acquired buffer as a hit if it was reused, or as a miss if it was allocated */
+	static void RecordAcquire(const bool bHit);
+
+	/** Reserves the bytes of a released buffer, returns false if the pool size limit would be exceeded */
+	static bool TryRetain(const int64 NumBytes);
+
+	/** Returns the bytes of a buffer that is no longer kept by a pool */
+	static void Unretain(const int64 NumBytes);
+
+	/** Frees the buffers kept by all pools */
+	static void EmptyAll();
+};
+
+
+/**
+ * Pool of buffers recycled between EXR write tasks, keyed by the number of elements
+ * Images of a sequence share the resolution and the bit depth, so after the first frames
+ * buffers are reused instead of being allocated and freed for every image
+*/
+template <typename ElementType>
+class TExrBufferPool
+{
+public:
+	/** Returns a buffer holding the number of uninitialized elements, reusing a released buffer of the same size if there is one */
+	static TArray64<ElementType> Acquire(const int64 NumElements)
+	{
+		TArray64<ElementType> Buffer;
+		bool bHit = false;
+		{
+			FScopeLock ScopeLock(&CriticalSection);
+			TArray<TArray64<ElementType>>* Buffers = FreeBuffers.Find(NumElements);
+			if (Buffers != nullptr && Buffers->Num() > 0)
+			{
+				Buffer = Buffers->Pop(EAllowShrinking::No);
+				bHit = true;
+			}
+		}
+
+		if (bHit)
+		{
+			FExrBufferPools::Unretain(Buffer.GetAllocatedSize());
+		}
+		else
+		{
+			Buffer.SetNumUninitialized(NumElements);
+		}
+		FExrBufferPools::RecordAcquire(bHit);
+		return Buffer;
+	}
+
+	/** Keeps the buffer for later acquires of the same size, or frees it if the pool is full */
+	static void Release(TArray64<ElementType>&& Buffer)
+	{
+		if (Buffer.Num() == 0 || !FExrBufferPools::TryRetain(Buffer.GetAllocatedSize()))
+		{
+			Buffer.Empty();
+			return;
+		}
+
+		FScopeLock ScopeLock(&CriticalSection);
+		FreeBuffers.FindOrAdd(Buffer.Num()).Add(MoveTemp(Buffer));
+	}
+
+	/** Frees all kept buffers */
+	static void Empty()
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+		for (TPair<int64, TArray<TArray64<ElementType>>>& Buffers : FreeBuffers)
+		{
+			for (const TArray64<ElementType>& Buffer : Buffers.Value)
+			{
+				FExrBufferPools::Unretain(Buffer.GetAllocatedSize());
+			}
+		}
+		FreeBuffers.Empty();
+	}
+
+private:
+	/** Released buffers, grouped by their number of elements */
+	static inline TMap<int64, TArray<TArray64<ElementType>>> FreeBuffers;
+
+	/** Guards the released buffers, as tasks release them from worker threads */
+	static inline FCriticalSection CriticalSection;
+};
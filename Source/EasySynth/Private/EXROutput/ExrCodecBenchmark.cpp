@@ -0,0 +1,208 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "EXROutput/ExrCodecBenchmark.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+
+#include "EasySynth.h"
+#include "EXROutput/MoviePipelineEXROutputLocal.h"
+
+#if WITH_UNREALEXR
+
+/**
+ * Output stream that keeps the encoded file in memory, so that disk writes are not a part of the measurement
+*/
+class FExrMemoryStreamOut : public Imf::OStream
+{
+public:
+	FExrMemoryStreamOut() : Imf::OStream("Memory"), Pos(0) {}
+
+	// InN must be 32bit to match the abstract interface.
+	virtual void write(const char c[/*n*/], int32 InN) override
+	{
+		if (Pos + InN > Data.Num())
+		{
+			Data.SetNumUninitialized(Pos + InN, EAllowShrinking::No);
+		}
+		FMemory::Memcpy(Data.GetData() + Pos, c, InN);
+		Pos += InN;
+	}
+
+	uint64_t tellp() override { return Pos; }
+
+	void seekp(uint64_t pos) override { Pos = pos; }
+
+	/** Size of the encoded file */
+	int64 GetFileSize() const { return Data.Num(); }
+
+private:
+	TArray64<uint8> Data;
+	int64 Pos;
+};
+#endif // WITH_UNREALEXR
+
+bool FExrCodecBenchmark::Run(const TArray<FString>& OutputDirectories, const int32 ImagesPerTarget, const FString& CsvFilePath)
+{
+#if WITH_UNREALEXR
+	const UEnum* CompressionEnum = StaticEnum<EEXRCompressionFormatLocal>();
+	check(CompressionEnum)
+	// The last enum entry is the generated MAX value
+	const int32 NumCompressions = CompressionEnum->NumEnums() - 1;
+
+	const TMap<FString, TArray<FString>> TargetImages = SampleImages(OutputDirectories, ImagesPerTarget);
+	if (TargetImages.Num() == 0)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: No EXR images found inside the output directories"), *FString(__FUNCTION__))
+		return false;
+	}
+
+	TArray<FString> Lines;
+	Lines.Add(TEXT("target,compression,images,pixel_bytes,encoded_bytes,compression_ratio,encode_mb_per_second"));
+	for (const TPair<FString, TArray<FString>>& Target : TargetImages)
+	{
+		TArray<FCodecResult> Results;
+		Results.SetNum(NumCompressions);
+		for (const FString& FilePath : Target.Value)
+		{
+			if (!BenchmarkImage(FilePath, Results))
+			{
+				UE_LOG(LogEasySynth, Warning, TEXT("%s: Skipping the image %s"), *FString(__FUNCTION__), *FilePath)
+			}
+		}
+
+		for (int32 i = 0; i < NumCompressions; i++)
+		{
+			const FCodecResult& Result = Results[i];
+			if (Result.NumImages == 0)
+			{
+				continue;
+			}
+
+			const double CompressionRatio = double(Result.PixelBytes) / FMath::Max(Result.EncodedBytes, int64(1));
+			const double MegabytesPerSecond = Result.PixelBytes / (1024.0 * 1024.0) / FMath::Max(Result.EncodeSeconds, UE_DOUBLE_SMALL_NUMBER);
+			Lines.Add(FString::Printf(TEXT("%s,%s,%d,%lld,%lld,%.3f,%.1f"),
+				*Target.Key,
+				*CompressionEnum->GetNameStringByIndex(i),
+				Result.NumImages,
+				Result.PixelBytes,
+				Result.EncodedBytes,
+				CompressionRatio,
+				MegabytesPerSecond));
+			UE_LOG(LogEasySynth, Log, TEXT("%s: %s %s - ratio %.3f, %.1f MB/s"), *FString(__FUNCTION__),
+				*Target.Key, *CompressionEnum->GetNameStringByIndex(i), CompressionRatio, MegabytesPerSecond)
+		}
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *CsvFilePath))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving the file %s"), *FString(__FUNCTION__), *CsvFilePath)
+		return false;
+	}
+
+	return true;
+#else
+	UE_LOG(LogEasySynth, Error, TEXT("%s: EXR support is not available on this platform"), *FString(__FUNCTION__))
+	return false;
+#endif // WITH_UNREALEXR
+}
+
+TMap<FString, TArray<FString>> FExrCodecBenchmark::SampleImages(const TArray<FString>& OutputDirectories, const int32 ImagesPerTarget)
+{
+	TMap<FString, TArray<FString>> TargetImages;
+	for (const FString& OutputDirectory : OutputDirectories)
+	{
+		const bool bFiles = true;
+		const bool bDirectories = false;
+		TArray<FString> FilePaths;
+		IFileManager::Get().FindFilesRecursive(FilePaths, *OutputDirectory, TEXT("*.exr"), bFiles, bDirectories);
+		for (const FString& FilePath : FilePaths)
+		{
+			TargetImages.FindOrAdd(FPaths::GetCleanFilename(FPaths::GetPath(FilePath))).Add(FilePath);
+		}
+	}
+
+	// Images are spread over the whole sequence, as the content of neighboring frames is similar
+	for (TPair<FString, TArray<FString>>& Target : TargetImages)
+	{
+		TArray<FString>& FilePaths = Target.Value;
+		FilePaths.Sort();
+		const int32 NumImages = FMath::Min(FilePaths.Num(), ImagesPerTarget);
+		TArray<FString> SampledFilePaths;
+		for (int32 i = 0; i < NumImages; i++)
+		{
+			SampledFilePaths.Add(FilePaths[int64(i) * FilePaths.Num() / NumImages]);
+		}
+		FilePaths = MoveTemp(SampledFilePaths);
+	}
+
+	return TargetImages;
+}
+
+bool FExrCodecBenchmark::BenchmarkImage(const FString& FilePath, TArray<FCodecResult>& OutResults)
+{
+#if WITH_UNREALEXR
+#if WITH_EDITOR
+	try
+#endif
+	{
+		// Read all channels into planar buffers, keeping their pixel types
+		Imf::InputFile InputFile(TCHAR_TO_UTF8(*FilePath));
+		const Imf::Header& Header = InputFile.header();
+		const IMATH_NAMESPACE::Box2i DataWindow = Header.dataWindow();
+		const int64 Width = DataWindow.max.x - DataWindow.min.x + 1;
+		const int64 Height = DataWindow.max.y - DataWindow.min.y + 1;
+
+		TArray<TArray64<uint8>> Channels;
+		Imf::FrameBuffer FrameBuffer;
+		int64 PixelBytes = 0;
+		for (Imf::ChannelList::ConstIterator Channel = Header.channels().begin(); Channel != Header.channels().end(); ++Channel)
+		{
+			const int64 ComponentWidth = (Channel.channel().type == Imf::PixelType::HALF) ? 2 : 4;
+			TArray64<uint8>& ChannelData = Channels.AddDefaulted_GetRef();
+			ChannelData.SetNumUninitialized(Width * Height * ComponentWidth);
+			PixelBytes += ChannelData.Num();
+
+			// Slices are addressed by data window coordinates, which do not have to start at zero
+			char* Origin = reinterpret_cast<char*>(ChannelData.GetData()) -
+				(DataWindow.min.y * Width + DataWindow.min.x) * ComponentWidth;
+			FrameBuffer.insert(Channel.name(), Imf::Slice(Channel.channel().type, Origin, ComponentWidth, Width * ComponentWidth));
+		}
+		InputFile.setFrameBuffer(FrameBuffer);
+		InputFile.readPixels(DataWindow.min.y, DataWindow.max.y);
+
+		for (int32 i = 0; i < OutResults.Num(); i++)
+		{
+			Imf::Header EncodeHeader(Header);
+			EncodeHeader.compression() =
+				FEXRImageWriteTaskLocal::GetImfCompression(static_cast<EEXRCompressionFormatLocal>(i));
+
+			FExrMemoryStreamOut OutputStream;
+			const double EncodeStartTime = FPlatformTime::Seconds();
+			{
+				Imf::OutputFile OutputFile(OutputStream, EncodeHeader, FEXRImageWriteTaskLocal::CompressionThreadBudget());
+				OutputFile.setFrameBuffer(FrameBuffer);
+				OutputFile.writePixels(Height);
+			}
+
+			FCodecResult& Result = OutResults[i];
+			Result.EncodeSeconds += FPlatformTime::Seconds() - EncodeStartTime;
+			Result.NumImages++;
+			Result.PixelBytes += PixelBytes;
+			Result.EncodedBytes += OutputStream.GetFileSize();
+		}
+	}
+#if WITH_EDITOR
+	catch (const IEX_NAMESPACE::BaseExc& Exception)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Caught exception: %hs"), *FString(__FUNCTION__), Exception.message().c_str())
+		return false;
+	}
+#endif
+
+	return true;
+#else
+	return false;
+#endif // WITH_UNREALEXR
+}
@@ -0,0 +1,41 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+ * Benchmark that encodes a sample of rendered EXR images with every supported compression method
+ * Images are grouped by target, named after the directory holding them, and the encoding throughput
+ * and the compression ratio of each target and compression method are written into a CSV file
+*/
+class FExrCodecBenchmark
+{
+public:
+	/** Benchmarks images found inside the output directories, using at most the number of images per target */
+	static bool Run(const TArray<FString>& OutputDirectories, const int32 ImagesPerTarget, const FString& CsvFilePath);
+
+private:
+	/** Encoding results of a single target and compression method */
+	struct FCodecResult
+	{
+		/** Number of encoded images */
+		int32 NumImages = 0;
+
+		/** Size of the uncompressed pixel data */
+		int64 PixelBytes = 0;
+
+		/** Size of the encoded files */
+		int64 EncodedBytes = 0;
+
+		/** Time spent encoding */
+		double EncodeSeconds = 0.0;
+	};
+
+	/** Finds EXR images inside the output directories and picks evenly spaced ones of each target */
+	static TMap<FString, TArray<FString>> SampleImages(const TArray<FString>& OutputDirectories, const int32 ImagesPerTarget);
+
+	/** Reads a single image and encodes it with every compression method, adding to the results of its target */
+	static bool BenchmarkImage(const FString& FilePath, TArray<FCodecResult>& OutResults);
+};
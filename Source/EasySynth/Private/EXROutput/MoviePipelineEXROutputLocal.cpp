@@ -2,54 +2,121 @@
 
 #include "EXROutput/MoviePipelineEXROutputLocal.h"
 
+#include "GenericPlatform/GenericPlatformFile.h"
 #include "HAL/PlatformFileManager.h"
 #include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
 #include "Misc/FileHelper.h"
 #include "Async/Async.h"
 #include "Misc/Paths.h"
 #include "HAL/PlatformTime.h"
+#include "Async/ParallelFor.h"
 #include "Math/Float16.h"
 #include "MovieRenderPipelineCoreModule.h"
 #include "MoviePipelineOutputSetting.h"
 #include "ImageWriteQueue.h"
 #include "MoviePipeline.h"
 #include "MoviePipelineImageQuantization.h"
+#include "MoviePipelineOutputBase.h"
 #include "MoviePipelinePrimaryConfig.h"
 #include "IOpenExrRTTIModule.h"
 #include "Modules/ModuleManager.h"
 #include "MoviePipelineUtils.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+#include "DatasetShardPacker.h"
+#include "EXROutput/ExrBufferPool.h"
+#include "RenderManifest.h"
+#include "RenderTelemetry.h"
 
 THIRD_PARTY_INCLUDES_START
 #include "OpenEXR/ImfChannelList.h"
+#include "OpenEXR/ImfThreading.h"
 THIRD_PARTY_INCLUDES_END
 
 #if WITH_UNREALEXR
 
-class FExrMemStreamOutLocal : public Imf::OStream
+TRACE_DECLARE_INT_COUNTER(EasySynthExrFilesWritten, TEXT("EasySynth/ExrFilesWritten"));
+TRACE_DECLARE_MEMORY_COUNTER(EasySynthExrBytesWritten, TEXT("EasySynth/ExrBytesWritten"));
+TRACE_DECLARE_INT_COUNTER(EasySynthExrQueueDepth, TEXT("EasySynth/ExrQueueDepth"));
+TRACE_DECLARE_FLOAT_COUNTER(EasySynthExrEncodeMilliseconds, TEXT("EasySynth/ExrEncodeMilliseconds"));
+
+static TAutoConsoleVariable<int32> CVarExrCompressionThreads(
+	TEXT("EasySynth.ExrCompressionThreads"),
+	0,
+	TEXT("Number of threads shared by all EXR images being compressed at the same time.\n")
+	TEXT("0 uses all logical cores except two, which are left to the game and the render thread."),
+	ECVF_Default);
+
+FThreadSafeCounter FEXRImageWriteTaskLocal::NumTasksInFlight;
+const float FEXRImageWriteTaskLocal::CentimetersToMeters = 0.01f;
+
+/**
+ * Output stream that writes encoded EXR chunks straight into the file through a write buffer,
+ * instead of holding the whole encoded file in memory until it is saved
+ * Seeking, used to write the scanline offsets once the pixels are written, flushes the buffer first
+ * The write buffer is taken from the buffer pool and returned to it once the file is closed
+ * Images packed into dataset shards are encoded into memory instead, as they are never written into files
+*/
+class FExrFileStreamOutLocal : public Imf::OStream
 {
 public:
 
-	FExrMemStreamOutLocal()
-		: Imf::OStream("")
+	FExrFileStreamOutLocal(const FString& InFilename, const bool bInMemoryStream)
+		: Imf::OStream(TCHAR_TO_ANSI(*InFilename))
+		, FileHandle(bInMemoryStream ? nullptr : FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*InFilename))
+		, Buffer(bInMemoryStream ? TArray64<uint8>() : TExrBufferPool<uint8>::Acquire(BufferSize))
 		, Pos(0)
+		, FileSize(0)
+		, WriteSeconds(0.0)
+		, bMemoryStream(bInMemoryStream)
+		, bFailed(!bInMemoryStream && FileHandle == nullptr)
+	{
+		Buffer.Reset();
+	}
+
+	virtual ~FExrFileStreamOutLocal()
 	{
+		Close();
 	}
 
 	// InN must be 32bit to match the abstract interface.
 	virtual void write(const char c[/*n*/], int32 InN)
 	{
-		int64 SrcN = (int64)InN;
-		int64 DestPost = Pos + SrcN;
-		if (DestPost > Data.Num())
+		if (bFailed)
 		{
-			Data.AddUninitialized(DestPost - Data.Num());
+			return;
 		}
 
-		for (int64 i = 0; i < SrcN; ++i)
+		// Encoded data is kept whole, so chunks are written at the current position, overwriting on seeks
+		if (bMemoryStream)
+		{
+			if (Pos + InN > Buffer.Num())
+			{
+				Buffer.SetNumUninitialized(Pos + InN);
+			}
+			FMemory::Memcpy(Buffer.GetData() + Pos, c, InN);
+			Pos += InN;
+			FileSize = FMath::Max(FileSize, Pos);
+			return;
+		}
+
+		// Chunks larger than the buffer are written directly, without copying them first
+		if (Buffer.Num() + InN > BufferSize)
+		{
+			Flush();
+		}
+		if (InN >= BufferSize)
 		{
-			Data[Pos + i] = c[i];
+			WriteToFile(reinterpret_cast<const uint8*>(c), InN);
 		}
-		Pos += SrcN;
+		else
+		{
+			Buffer.Append(reinterpret_cast<const uint8*>(c), InN);
+		}
+
+		Pos += InN;
+		FileSize = FMath::Max(FileSize, Pos);
 	}
 
 
@@ -73,14 +140,164 @@ public:
 
 	void seekp(uint64_t pos) override
 	{
+		if (bMemoryStream)
+		{
+			Pos = pos;
+			return;
+		}
+
+		Flush();
+		if (!bFailed && !FileHandle->Seek(pos))
+		{
+			bFailed = true;
+		}
 		Pos = pos;
 	}
 
+	/** Writes the buffered data and closes the file, returns false if any of the writes failed */
+	bool Close()
+	{
+		if (bMemoryStream)
+		{
+			return !bFailed;
+		}
+
+		Flush();
+		FileHandle.Reset();
+
+		// The pool matches buffers by their size, which is restored without touching the allocation
+		if (Buffer.Max() >= BufferSize)
+		{
+			Buffer.SetNumUninitialized(BufferSize);
+			TExrBufferPool<uint8>::Release(MoveTemp(Buffer));
+		}
+		return !bFailed;
+	}
+
+	/** Checks if the file was opened for writing */
+	bool IsOpen() const { return bMemoryStream || FileHandle.IsValid(); }
+
+	/** Takes the data encoded into memory */
+	TArray64<uint8> TakeData()
+	{
+		check(bMemoryStream);
+		return MoveTemp(Buffer);
+	}
+
+	/** Size of the written file */
+	int64 GetFileSize() const { return FileSize; }
+
+	/** Time spent writing into the file */
+	double GetWriteSeconds() const { return WriteSeconds; }
+
+private:
+
+	void Flush()
+	{
+		if (Buffer.Num() > 0)
+		{
+			WriteToFile(Buffer.GetData(), Buffer.Num());
+			Buffer.Reset();
+		}
+	}
+
+	void WriteToFile(const uint8* Data, const int64 NumBytes)
+	{
+		if (bFailed)
+		{
+			return;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(EasySynthExrWrite);
+		const double WriteStartTime = FPlatformTime::Seconds();
+		bFailed = !FileHandle->Write(Data, NumBytes);
+		WriteSeconds += FPlatformTime::Seconds() - WriteStartTime;
+	}
+
+	// Large enough for a few scanline chunks of an 8K image, so most chunks are combined into one write
+	static constexpr int32 BufferSize = 4 * 1024 * 1024;
 
+	TUniquePtr<IFileHandle> FileHandle;
+	TArray64<uint8> Buffer;
 	int64 Pos;
-	TArray64<uint8> Data;
+	int64 FileSize;
+	double WriteSeconds;
+	bool bMemoryStream;
+	bool bFailed;
 };
 
+template <typename PixelType>
+static TUniquePtr<FImagePixelData> CopyIntoPooledLayer(const FImagePixelData* InLayer)
+{
+	const TArray64<PixelType>& SourcePixels = static_cast<const TImagePixelData<PixelType>*>(InLayer)->Pixels;
+	TArray64<PixelType> Pixels = TExrBufferPool<PixelType>::Acquire(SourcePixels.Num());
+	FMemory::Memcpy(Pixels.GetData(), SourcePixels.GetData(), SourcePixels.NumBytes());
+	return MakeUnique<TImagePixelData<PixelType>>(
+		InLayer->GetSize(), MoveTemp(Pixels), InLayer->GetPayload<FImagePixelDataPayload>()->Copy());
+}
+
+/**
+ * Copies a layer into pixel data backed by a pooled buffer
+ * Returns nullptr for pixel types other than the four channel colors written by the render passes
+*/
+static TUniquePtr<FImagePixelData> CopyIntoPooledLayer(const FImagePixelData* InLayer)
+{
+	if (InLayer->GetNumChannels() != 4)
+	{
+		return nullptr;
+	}
+	switch (InLayer->GetType())
+	{
+	case EImagePixelType::Color: return CopyIntoPooledLayer<FColor>(InLayer);
+	case EImagePixelType::Float16: return CopyIntoPooledLayer<FFloat16Color>(InLayer);
+	case EImagePixelType::Float32: return CopyIntoPooledLayer<FLinearColor>(InLayer);
+	default: return nullptr;
+	}
+}
+
+/** Returns the pixel buffer of a layer created by CopyIntoPooledLayer into the pool, leaving the layer empty */
+static void ReleasePooledLayer(FImagePixelData* InLayer)
+{
+	switch (InLayer->GetType())
+	{
+	case EImagePixelType::Color:
+		TExrBufferPool<FColor>::Release(MoveTemp(static_cast<TImagePixelData<FColor>*>(InLayer)->Pixels));
+		break;
+	case EImagePixelType::Float16:
+		TExrBufferPool<FFloat16Color>::Release(MoveTemp(static_cast<TImagePixelData<FFloat16Color>*>(InLayer)->Pixels));
+		break;
+	case EImagePixelType::Float32:
+		TExrBufferPool<FLinearColor>::Release(MoveTemp(static_cast<TImagePixelData<FLinearColor>*>(InLayer)->Pixels));
+		break;
+	default:
+		checkNoEntry();
+	}
+}
+
+FEXRImageWriteTaskLocal::FEXRImageWriteTaskLocal()
+	: bOverwriteFile(true)
+	, Compression(EEXRCompressionFormatLocal::PIZ)
+	, CompressionLevel(45)
+	, OverscanPercentage(0.0f)
+	, RawOutput(ERawImageOutput::None)
+{
+	TRACE_COUNTER_SET(EasySynthExrQueueDepth, NumTasksInFlight.Increment());
+}
+
+FEXRImageWriteTaskLocal::~FEXRImageWriteTaskLocal()
+{
+	// Layers are destroyed with the task, so their pooled pixel buffers can be reused by the next frames
+	for (TUniquePtr<FImagePixelData>& Layer : Layers)
+	{
+		if (PooledLayers.Contains(Layer.Get()))
+		{
+			ReleasePooledLayer(Layer.Get());
+		}
+	}
+
+	TRACE_COUNTER_SET(EasySynthExrQueueDepth, NumTasksInFlight.Decrement());
+}
+
 bool FEXRImageWriteTaskLocal::RunTask()
 {
 	bool bSuccess = WriteToDisk();
@@ -101,6 +318,53 @@ void FEXRImageWriteTaskLocal::OnAbandoned()
 	}
 }
 
+int32 FEXRImageWriteTaskLocal::CompressionThreadBudget()
+{
+	int32 NumThreads = CVarExrCompressionThreads.GetValueOnAnyThread();
+	if (NumThreads <= 0)
+	{
+		NumThreads = FMath::Max(1, FPlatformMisc::NumberOfCoresIncludingHyperthreads() - 2);
+	}
+
+	static FCriticalSection ThreadPoolCriticalSection;
+	static int32 ThreadPoolSize = INDEX_NONE;
+	FScopeLock ScopeLock(&ThreadPoolCriticalSection);
+	if (ThreadPoolSize != NumThreads)
+	{
+		Imf::setGlobalThreadCount(NumThreads);
+		ThreadPoolSize = NumThreads;
+	}
+	return NumThreads;
+}
+
+Imf::Compression FEXRImageWriteTaskLocal::GetImfCompression(const EEXRCompressionFormatLocal InCompression)
+{
+	switch (InCompression)
+	{
+		case EEXRCompressionFormatLocal::None:
+			return Imf::Compression::NO_COMPRESSION;
+		case EEXRCompressionFormatLocal::ZIP:
+			return Imf::Compression::ZIP_COMPRESSION;
+		case EEXRCompressionFormatLocal::PIZ:
+			return Imf::Compression::PIZ_COMPRESSION;
+		case EEXRCompressionFormatLocal::DWAA:
+			return Imf::Compression::DWAA_COMPRESSION;
+		case EEXRCompressionFormatLocal::DWAB:
+			return Imf::Compression::DWAB_COMPRESSION;
+		case EEXRCompressionFormatLocal::RLE:
+			return Imf::Compression::RLE_COMPRESSION;
+		case EEXRCompressionFormatLocal::ZIPS:
+			return Imf::Compression::ZIPS_COMPRESSION;
+		case EEXRCompressionFormatLocal::B44:
+			return Imf::Compression::B44_COMPRESSION;
+		case EEXRCompressionFormatLocal::B44A:
+			return Imf::Compression::B44A_COMPRESSION;
+		default:
+			checkNoEntry();
+	}
+	return Imf::Compression::NO_COMPRESSION;
+}
+
 bool FEXRImageWriteTaskLocal::WriteToDisk()
 {
 	// Ensure that the payload filename has the correct extension for the format
@@ -110,26 +374,13 @@ bool FEXRImageWriteTaskLocal::WriteToDisk()
 		Filename = FPaths::GetBaseFilename(Filename, false) + FormatExtension;
 	}
 
-	bool bSuccess = EnsureWritableFile();
+	// Packed images are handed to the dataset shard packer instead of being written, so no file is prepared for them
+	const bool bPacked = FDatasetShardPacker::IsPacked(Filename);
+	bool bSuccess = bPacked || EnsureWritableFile();
 
 	if (bSuccess)
 	{
-		Imf::Compression FileCompression = Imf::Compression::NO_COMPRESSION;
-		switch(Compression)
-		{
-			case EEXRCompressionFormatLocal::None:
-				FileCompression = Imf::Compression::NO_COMPRESSION; break;
-			case EEXRCompressionFormatLocal::ZIP:
-				FileCompression = Imf::Compression::ZIP_COMPRESSION; break;
-			case EEXRCompressionFormatLocal::PIZ:
-				FileCompression = Imf::Compression::PIZ_COMPRESSION; break;
-			case EEXRCompressionFormatLocal::DWAA:
-				FileCompression = Imf::Compression::DWAA_COMPRESSION; break;
-			case EEXRCompressionFormatLocal::DWAB:
-				FileCompression = Imf::Compression::DWAB_COMPRESSION; break;
-			default:
-				checkNoEntry();
-		}
+		Imf::Compression FileCompression = GetImfCompression(Compression);
 
 		// Data Window specifies how much data is in the actual file, ie: 1920x1080
 		IMATH_NAMESPACE::Box2i DataWindow = IMATH_NAMESPACE::Box2i(IMATH_NAMESPACE::V2i(0,0), IMATH_NAMESPACE::V2i(Width - 1, Height - 1));
@@ -159,17 +410,26 @@ bool FEXRImageWriteTaskLocal::WriteToDisk()
 		// Insert our key-value pair metadata (if any, can be an arbitrary set of key/value pairs)
 		AddFileMetadata(Header);
 
-		FExrMemStreamOutLocal OutputFile;
+		// Encoded chunks are streamed into the file while the pixels are being compressed
+		FExrFileStreamOutLocal OutputFile(Filename, bPacked);
+		bSuccess = OutputFile.IsOpen();
 
+		if (bSuccess)
 		{
+			EASYSYNTH_STAGE_SCOPE(TEXT("ExrEncode"));
+			const double EncodeStartTime = FPlatformTime::Seconds();
+
 			// The FrameBuffer stores all the channels of the resulting image.
 			Imf::FrameBuffer FrameBuffer;
 
-			// If we have to quantize the data (ie: Upscale 8 bit to 16 bit) we need to store them long enough for the file to get written.
-			TArray<TUniquePtr<FImagePixelData>> QuantizedData;
-
 			for (TUniquePtr<FImagePixelData>& Layer : Layers)
 			{
+				// A raw output file only holds the main layer
+				if (RawOutput != ERawImageOutput::None && Layer.Get() != Layers[0].Get())
+				{
+					continue;
+				}
+
 				uint8 RawBitDepth = Layer->GetBitDepth();
 				check(RawBitDepth == 8 || RawBitDepth == 16 || RawBitDepth == 32);
 
@@ -187,43 +447,57 @@ bool FEXRImageWriteTaskLocal::WriteToDisk()
 					break;
 				}
 
-				int64 BytesWritten = 0;
 				switch (RawBitDepth)
 				{
 				case 8:
 				{
+					// EXR files have no 8-bit channel type. The task owns its layers, so the 8-bit layer
+					// is replaced by its 16-bit version instead of keeping both until the file is written.
 					TUniquePtr<FImagePixelData> QuantizedPixelData = UE::MoviePipeline::QuantizeImagePixelDataToBitDepth(Layer.Get(), 16);
-					QuantizedData.Add(MoveTemp(QuantizedPixelData));
 
-					// Add an entry in the LayerNames table if needed since it matches by Layer pointer but that has changed.
-					FString LayerName = LayerNames.FindOrAdd(Layer.Get());
+					// Update the entry in the LayerNames table since it matches by Layer pointer but that has changed.
+					FString LayerName;
+					LayerNames.RemoveAndCopyValue(Layer.Get(), LayerName);
+					PooledLayers.Remove(Layer.Get());
 					if (LayerName.Len() > 0)
 					{
-						LayerNames.Add(QuantizedData.Last().Get(), LayerName);
+						LayerNames.Add(QuantizedPixelData.Get(), LayerName);
 					}
+					Layer = MoveTemp(QuantizedPixelData);
 
-					BytesWritten = CompressRaw<Imf::HALF>(Header, FrameBuffer, QuantizedData.Last().Get());
+					CompressRaw<Imf::HALF>(Header, FrameBuffer, Layer.Get());
 				}
 					break;
 				case 16:
-					BytesWritten = CompressRaw<Imf::HALF>(Header, FrameBuffer, Layer.Get());
+					if (RawOutput != ERawImageOutput::None)
+					{
+						// Raw values are always written as 32-bit floats, even if the pass was rendered in 16-bit
+						PromoteToFloat32(Layer);
+						ConvertToRawOutput(Layer.Get());
+						CompressRaw<Imf::FLOAT>(Header, FrameBuffer, Layer.Get());
+					}
+					else
+					{
+						CompressRaw<Imf::HALF>(Header, FrameBuffer, Layer.Get());
+					}
 					break;
 				case 32:
-					BytesWritten = CompressRaw<Imf::FLOAT>(Header, FrameBuffer, Layer.Get());
+					if (RawOutput != ERawImageOutput::None)
+					{
+						ConvertToRawOutput(Layer.Get());
+					}
+					CompressRaw<Imf::FLOAT>(Header, FrameBuffer, Layer.Get());
 					break;
 				default:
 					checkNoEntry();
 				}
-
-				// Reserve enough space in the output file for the whole layer so we don't keep reallocating.
-				OutputFile.Data.Reserve(BytesWritten);
 			}
 
 			// This scope ensures that IMF::Outputfile creates a complete file by closing the file when it goes out of scope.
 			// To complete the file, EXR seeks back into the file and writes the scanline offsets when the file is closed,
 			// which moves the tellp location. So file length is stored in advance for later use. The output file needs to be
 			// created after the header information is filled.
-			Imf::OutputFile ImfFile(OutputFile, Header, FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+			Imf::OutputFile ImfFile(OutputFile, Header, CompressionThreadBudget());
 #if WITH_EDITOR
 			try
 #endif
@@ -237,12 +511,25 @@ bool FEXRImageWriteTaskLocal::WriteToDisk()
 				UE_LOG(LogMovieRenderPipelineIO, Error, TEXT("Caught exception: %hs"), Exception.message().c_str());
 			}
 #endif
+			TRACE_COUNTER_SET(EasySynthExrEncodeMilliseconds, (FPlatformTime::Seconds() - EncodeStartTime) * 1000.0);
 		}
 
-		// Now that the scope has closed for the Imf::OutputFile, now we can write the data to disk.
-		if (bSuccess)
+		// Now that the scope has closed for the Imf::OutputFile, the remaining buffered data can be written and the file closed.
+		if (bPacked)
+		{
+			bSuccess = OutputFile.Close() && bSuccess && FDatasetShardPacker::PackImage(Filename, OutputFile.TakeData());
+		}
+		else if (OutputFile.Close() && bSuccess)
 		{
-			bSuccess = FFileHelper::SaveArrayToFile(OutputFile.Data, *Filename);
+			FRenderTelemetry::Get().AddSample(TEXT("ExrWrite"), OutputFile.GetWriteSeconds(), OutputFile.GetFileSize());
+			TRACE_COUNTER_INCREMENT(EasySynthExrFilesWritten);
+			TRACE_COUNTER_ADD(EasySynthExrBytesWritten, OutputFile.GetFileSize());
+		}
+		else
+		{
+			// Do not leave a truncated image behind
+			bSuccess = false;
+			IFileManager::Get().Delete(*Filename);
 		}
 	}
 
@@ -323,9 +610,20 @@ int64 FEXRImageWriteTaskLocal::CompressRaw(Imf::Header& InHeader, Imf::FrameBuff
 	int32 NumChannels = InLayer->GetNumChannels();
 	int32 ComponentWidth = GetComponentWidth(InLayer->GetType());
 
-	for (int32 Channel = 0; Channel < NumChannels; Channel++)
+	// Raw outputs only reference the leading components of each interleaved pixel, without copying the data
+	int32 NumWrittenChannels = NumChannels;
+	switch (RawOutput)
 	{
-		FString ChannelName = GetChannelName(LayerName, Channel, InLayer->GetPixelLayout());
+	case ERawImageOutput::DepthMeters: NumWrittenChannels = 1; break;
+	case ERawImageOutput::OpticalFlowPixels: NumWrittenChannels = 2; break;
+	default: break;
+	}
+
+	for (int32 Channel = 0; Channel < NumWrittenChannels; Channel++)
+	{
+		FString ChannelName = (RawOutput == ERawImageOutput::DepthMeters) ?
+			FString(TEXT("Y")) :
+			GetChannelName(LayerName, Channel, InLayer->GetPixelLayout());
 
 		// Insert the channel into the header with the right datatype.
 		InHeader.channels().insert(TCHAR_TO_ANSI(*ChannelName), Imf::Channel(OutputFormat));
@@ -338,7 +636,79 @@ int64 FEXRImageWriteTaskLocal::CompressRaw(Imf::Header& InHeader, Imf::FrameBuff
 				Width * ComponentWidth * NumChannels));		// yStride
 	}
 
-	return int64(Width) * int64(Height) * NumChannels * int64(OutputFormat == 2 ? 4 : 2);
+	return int64(Width) * int64(Height) * NumWrittenChannels * int64(OutputFormat == 2 ? 4 : 2);
+}
+
+void FEXRImageWriteTaskLocal::ConvertToRawOutput(FImagePixelData* InLayer)
+{
+	void* RawDataPtr;
+	int64 RawDataSize;
+	if (!InLayer->GetRawData(RawDataPtr, RawDataSize))
+	{
+		return;
+	}
+
+	// The layer is owned by this task, so it is converted in place
+	const int32 NumChannels = InLayer->GetNumChannels();
+	if (RawOutput == ERawImageOutput::OpticalFlowPixels && NumChannels < 2)
+	{
+		UE_LOG(LogMovieRenderPipelineIO, Error, TEXT("Optical flow conversion requires two channels, writing the layer unchanged."));
+		return;
+	}
+
+	float* Values = static_cast<float*>(RawDataPtr);
+	const ERawImageOutput LocalRawOutput = RawOutput;
+	const int32 LocalWidth = Width;
+	const int32 LocalHeight = Height;
+	ParallelFor(Height, [Values, NumChannels, LocalRawOutput, LocalWidth, LocalHeight](const int32 Row)
+	{
+		float* RowValues = Values + int64(Row) * LocalWidth * NumChannels;
+		for (int32 Column = 0; Column < LocalWidth; Column++)
+		{
+			float* Pixel = RowValues + Column * NumChannels;
+			if (LocalRawOutput == ERawImageOutput::DepthMeters)
+			{
+				// Scene depth is rendered in centimeters
+				Pixel[0] *= CentimetersToMeters;
+			}
+			else if (LocalRawOutput == ERawImageOutput::OpticalFlowPixels)
+			{
+				// The flow pass renders the flow vector with the image scaled to a 1.0 x 1.0 square
+				Pixel[0] *= LocalWidth;
+				Pixel[1] *= LocalHeight;
+			}
+		}
+	});
+}
+
+void FEXRImageWriteTaskLocal::PromoteToFloat32(TUniquePtr<FImagePixelData>& Layer)
+{
+	if (Layer->GetType() != EImagePixelType::Float16 || Layer->GetNumChannels() != 4)
+	{
+		return;
+	}
+
+	const TArray64<FFloat16Color>& HalfPixels = static_cast<const TImagePixelData<FFloat16Color>*>(Layer.Get())->Pixels;
+	TArray64<FLinearColor> Pixels = TExrBufferPool<FLinearColor>::Acquire(HalfPixels.Num());
+	for (int64 i = 0; i < HalfPixels.Num(); i++)
+	{
+		Pixels[i] = HalfPixels[i].GetFloats();
+	}
+	TUniquePtr<FImagePixelData> PromotedLayer = MakeUnique<TImagePixelData<FLinearColor>>(
+		Layer->GetSize(), MoveTemp(Pixels), Layer->GetPayload<FImagePixelDataPayload>()->Copy());
+
+	// Layer names match by the layer pointer, and the 16-bit buffer can be reused right away
+	FString LayerName;
+	if (LayerNames.RemoveAndCopyValue(Layer.Get(), LayerName))
+	{
+		LayerNames.Add(PromotedLayer.Get(), LayerName);
+	}
+	if (PooledLayers.Remove(Layer.Get()) > 0)
+	{
+		ReleasePooledLayer(Layer.Get());
+	}
+	PooledLayers.Add(PromotedLayer.Get());
+	Layer = MoveTemp(PromotedLayer);
 }
 
 bool FEXRImageWriteTaskLocal::EnsureWritableFile()
@@ -380,12 +750,29 @@ void FEXRImageWriteTaskLocal::AddFileMetadata(Imf::Header& InHeader)
 
 #endif // WITH_UNREALEXR
 
+void UMoviePipelineImageSequenceOutput_EXRLocal::FinalizeImpl()
+{
+	Super::FinalizeImpl();
+
+#if WITH_UNREALEXR
+	// Buffers are only kept while a job is writing images, so idle editors do not hold on to them
+	FExrBufferPools::EmptyAll();
+#endif // WITH_UNREALEXR
+}
+
+bool UMoviePipelineImageSequenceOutput_EXRLocal::IsOnlyEnabledOutput() const
+{
+	const TArray<UMoviePipelineSetting*> OutputSettings =
+		GetPipeline()->GetPipelinePrimaryConfig()->FindSettingsByClass(UMoviePipelineOutputBase::StaticClass());
+	return OutputSettings.Num() == 1 && OutputSettings[0] == this;
+}
+
 void UMoviePipelineImageSequenceOutput_EXRLocal::OnReceiveImageDataImpl(FMoviePipelineMergerOutputFrame* InMergedOutputFrame)
 {
 	if (!bMultilayer)
 	{
 		// Some software doesn't support multi-layer, so in that case we fall back to the single-layer-multiple-file
-		// codepath of our parent.
+		// codepath of our parent, which tracks the written files as well.
 		Super::OnReceiveImageDataImpl(InMergedOutputFrame);
 		return;
 	}
@@ -399,6 +786,9 @@ void UMoviePipelineImageSequenceOutput_EXRLocal::OnReceiveImageDataImpl(FMoviePi
 	UMoviePipelineOutputSetting* OutputSettings = GetPipeline()->GetPipelinePrimaryConfig()->FindSetting<UMoviePipelineOutputSetting>();
 	check(OutputSettings);
 
+	// Merged frames are discarded once all output settings receive them, so the only enabled output can take over the pixel data
+	const bool bTakePixelData = IsOnlyEnabledOutput();
+
 	// EXR only supports one resolution per file, but in certain scenarios we can get layers with different resolutions. To solve this, we're
 	// going to write one exr file per image resolution. First we loop through all layers to figure out how many sizes we're dealing with.
 	TArray<FIntPoint> Resolutions;
@@ -471,6 +861,7 @@ void UMoviePipelineImageSequenceOutput_EXRLocal::OnReceiveImageDataImpl(FMoviePi
 		TUniquePtr<FEXRImageWriteTaskLocal> MultiLayerImageTask = MakeUnique<FEXRImageWriteTaskLocal>();
 		MultiLayerImageTask->Filename = FinalFilePath;
 		MultiLayerImageTask->Compression = Compression;
+		MultiLayerImageTask->RawOutput = RawOutput;
 		// MultiLayerImageTask->CompressionLevel is intentionally skipped because it doesn't seem to make any practical difference
 		// so we don't expose it to the user because that will just cause confusion where the setting doesn't seem to do anything.
 
@@ -489,24 +880,49 @@ void UMoviePipelineImageSequenceOutput_EXRLocal::OnReceiveImageDataImpl(FMoviePi
 		int32 ShotIndex = 0;
 		for (TPair<FMoviePipelinePassIdentifier, TUniquePtr<FImagePixelData>>& RenderPassData : InMergedOutputFrame->ImageOutputData)
 		{
-			if (RenderPassData.Value->GetSize() != Resolutions[Index])
+			// Layers taken over by the task of a previous resolution are no longer in the frame
+			if (!RenderPassData.Value.IsValid() || RenderPassData.Value->GetSize() != Resolutions[Index])
 			{
 				// If this layer isn't for this resolution, don't add it to the multilayer task, a second task will be created soon.
 				continue;
 			}
 
-			// No quantization required, just copy the data as we will move it into the image write task.
-			TUniquePtr<FImagePixelData> PixelData = RenderPassData.Value->CopyImageData();
+			// No quantization required, so the data is moved into the image write task as is.
+			// It is only copied if another output setting still needs to read the same frame,
+			// into buffers recycled from the previous frames when possible.
+			TUniquePtr<FImagePixelData> PixelData;
+			if (bTakePixelData)
+			{
+				PixelData = MoveTemp(RenderPassData.Value);
+			}
+			else
+			{
+				PixelData = CopyIntoPooledLayer(RenderPassData.Value.Get());
+				if (PixelData.IsValid())
+				{
+					MultiLayerImageTask->PooledLayers.Add(PixelData.Get());
+				}
+				else
+				{
+					PixelData = RenderPassData.Value->CopyImageData();
+				}
+			}
 
 			// If there is more than one layer, then we will prefix the layer. The first layer is not prefixed (and gets inserted as RGBA)
 			// as most programs that handle EXRs expect the main image data to be in an unnamed layer.
 			if (LayerIndex == 0)
 			{
 				// Only check the main image pass for transparent output since that's generally considered the 'preview'.
-				FImagePixelDataPayload* Payload = RenderPassData.Value->GetPayload<FImagePixelDataPayload>();
+				FImagePixelDataPayload* Payload = PixelData->GetPayload<FImagePixelDataPayload>();
 				bRequiresTransparentOutput = Payload->bRequireTransparentOutput;
 				ShotIndex = Payload->SampleState.OutputState.ShotIndex;
 				MultiLayerImageTask->OverscanPercentage = Payload->SampleState.OverscanPercentage;
+
+				// Every layer is a separate target, so none of them is the unnamed main image
+				if (bNameAllLayers)
+				{
+					MultiLayerImageTask->LayerNames.FindOrAdd(PixelData.Get(), RenderPassData.Key.Name);
+				}
 			}
 			else
 			{
@@ -525,7 +941,7 @@ void UMoviePipelineImageSequenceOutput_EXRLocal::OnReceiveImageDataImpl(FMoviePi
 		OutputData.Shot = GetPipeline()->GetActiveShotList()[ShotIndex];
 		OutputData.PassIdentifier = FMoviePipelinePassIdentifier(TEXT("")); // exrs put all the render passes internally so this resolves to a ""
 		OutputData.FilePath = FinalFilePath;
-		GetPipeline()->AddOutputFuture(ImageWriteQueue->Enqueue(MoveTemp(MultiLayerImageTask)), OutputData);
+		GetPipeline()->AddOutputFuture(FRenderManifest::TrackWrite(ImageWriteQueue->Enqueue(MoveTemp(MultiLayerImageTask)), FinalFilePath), OutputData);
 
 #if WITH_EDITOR
 		GetPipeline()->AddFrameToOutputMetadata(ClipName, FinalImageSequenceFileName, InMergedOutputFrame->FrameOutputState, Extension, bRequiresTransparentOutput);
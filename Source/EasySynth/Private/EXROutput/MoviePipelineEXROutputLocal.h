@@ -3,8 +3,10 @@
 
 #include "ImageWriteTask.h"
 #include "ImagePixelData.h"
-#include "MoviePipelineImageSequenceOutput.h"
+#include "ImageOutput/MoviePipelineImageOutputLocal.h"
+#include "HAL/ThreadSafeCounter.h"
 #include "Misc/StringFormatArg.h"
+#include "RendererTargets/RawImageOutput.h"
 
 #if WITH_UNREALEXR
 THIRD_PARTY_INCLUDES_START
@@ -34,7 +36,15 @@ enum class EEXRCompressionFormatLocal : uint8
 	/** Lossy DCT-based compression for RGB channels. Alpha and other channels are uncompressed. More efficient than DWAB for partial buffer access on read in 3rd party tools. */
 	DWAA,
 	/** Similar to DWAA but goes in blocks of 256 scanlines instead of 32. More efficient disk space and faster to decode than DWAA. */
-	DWAB
+	DWAB,
+	/** Run length encoding. Lossless and very fast, but only effective for images with large flat areas. */
+	RLE,
+	/** Same as ZIP but compresses one scanline at a time instead of 16. Lossless, faster to decode partially. */
+	ZIPS,
+	/** Lossy fixed rate compression of 4x4 pixel blocks of half channels. Float channels are uncompressed. */
+	B44,
+	/** Same as B44 but flat 4x4 blocks are stored in 3 bytes instead of 14. Float channels are uncompressed. */
+	B44A
 };
 
 #if WITH_UNREALEXR
@@ -74,18 +84,32 @@ public:
 	/** Overscan info used to create apropriate dataWindow for EXR output. Goes from 0.0 to 1.0. */
 	float OverscanPercentage;
 
-	FEXRImageWriteTaskLocal()
-		: bOverwriteFile(true)
-		, Compression(EEXRCompressionFormatLocal::PIZ)
-		, CompressionLevel(45)
-		, OverscanPercentage(0.0f)
-	{}
+	/** Raw values the first layer is converted into. Other layers are skipped for raw outputs. */
+	ERawImageOutput RawOutput;
+
+	/** Layers whose pixel buffers were taken from the buffer pool, and are returned to it when the task is destroyed */
+	TSet<const FImagePixelData*> PooledLayers;
+
+	/** Counts the task as queued, until it is destroyed after being written or abandoned */
+	FEXRImageWriteTaskLocal();
+
+	virtual ~FEXRImageWriteTaskLocal();
 
 public:
 
 	virtual bool RunTask() override final;
 	virtual void OnAbandoned() override final;
 
+	/** Converts the compression method into the OpenEXR one */
+	static Imf::Compression GetImfCompression(const EEXRCompressionFormatLocal InCompression);
+
+	/**
+	 * Returns the number of compression threads, resizing the OpenEXR thread pool when the budget changes
+	 * All images are compressed by the same global pool, so concurrent writes share the budget
+	 * instead of each one using all of the cores
+	 */
+	static int32 CompressionThreadBudget();
+
 private:
 
 	/**
@@ -107,13 +131,29 @@ private:
 	*/
 	void AddFileMetadata(Imf::Header& InHeader);
 
+	/**
+	 * Converts the values of a 32-bit float layer into the raw output values, in place
+	 */
+	void ConvertToRawOutput(FImagePixelData* InLayer);
+
+	/**
+	 * Replaces a 16-bit float layer with its 32-bit version, so that raw output values keep their precision
+	 */
+	void PromoteToFloat32(TUniquePtr<FImagePixelData>& Layer);
+
+	/** Scale converting rendered scene depth in centimeters into meters */
+	static const float CentimetersToMeters;
+
 	template <Imf::PixelType OutputFormat>
 	int64 CompressRaw(Imf::Header& InHeader, Imf::FrameBuffer& InFrameBuffer, FImagePixelData* InLayer);
+
+	/** Number of tasks created and not yet destroyed, shown as the EXR queue depth */
+	static FThreadSafeCounter NumTasksInFlight;
 };
 #endif // WITH_UNREALEXR
 
 UCLASS()
-class UMoviePipelineImageSequenceOutput_EXRLocal : public UMoviePipelineImageSequenceOutputBase
+class UMoviePipelineImageSequenceOutput_EXRLocal : public UMoviePipelineImageSequenceOutputLocalBase
 {
 	GENERATED_BODY()
 public:
@@ -126,10 +166,20 @@ public:
 		OutputFormat = EImageFormat::EXR;
 		Compression = EEXRCompressionFormatLocal::PIZ;
 		bMultilayer = true;
+		bNameAllLayers = false;
+		RawOutput = ERawImageOutput::None;
 	}
 
 	virtual void OnReceiveImageDataImpl(FMoviePipelineMergerOutputFrame* InMergedOutputFrame) override;
 
+	virtual void FinalizeImpl() override;
+
+private:
+	/**
+	* Checks if no other enabled output setting receives the merged frames, so that their pixel data can be taken over
+	*/
+	bool IsOnlyEnabledOutput() const;
+
 public:
 	/**
 	* Which compression method should the resulting EXR file be compressed with
@@ -142,4 +192,18 @@ public:
 	*/
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EXR")
 	bool bMultilayer;
+
+	/**
+	* Should the main layer of a multi-layer exr file also be named after its render pass, instead of being unnamed?
+	* Used when every render pass is a separate target, so that loaders can find each one by name.
+	*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "EXR")
+	bool bNameAllLayers;
+
+	/**
+	* Raw values the main layer is converted into instead of writing its color, such as depth in meters.
+	* Requires multi-layer output, as the file is written by this class instead of the parent.
+	*/
+	UPROPERTY(EditAnywhere, Category = "EXR")
+	ERawImageOutput RawOutput;
 };
@@ -0,0 +1,184 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "ImageOutput/MoviePipelineImageOutputLocal.h"
+
+#include "IImageWrapperModule.h"
+#include "ImageWriteQueue.h"
+#include "Modules/ModuleManager.h"
+#include "MoviePipeline.h"
+#include "MoviePipelineImageQuantization.h"
+#include "MoviePipelineOutputSetting.h"
+#include "MoviePipelinePrimaryConfig.h"
+#include "MoviePipelineUtils.h"
+
+#include "DatasetShardPacker.h"
+#include "EasySynth.h"
+#include "RenderManifest.h"
+
+
+bool FPackedImageWriteTaskLocal::RunTask()
+{
+	if (!FDatasetShardPacker::IsPacked(WriteTask->Filename))
+	{
+		return WriteTask->RunTask();
+	}
+
+	TArray64<uint8> EncodedData;
+	if (!EncodeImage(EncodedData))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not encode the image %s"), *FString(__FUNCTION__), *WriteTask->Filename)
+		return false;
+	}
+	return FDatasetShardPacker::PackImage(WriteTask->Filename, MoveTemp(EncodedData));
+}
+
+bool FPackedImageWriteTaskLocal::EncodeImage(TArray64<uint8>& OutData)
+{
+	FImagePixelData* PixelData = WriteTask->PixelData.Get();
+	for (const FPixelPreProcessor& PreProcessor : WriteTask->PixelPreProcessors)
+	{
+		PreProcessor(PixelData);
+	}
+
+	ERGBFormat RGBFormat;
+	int32 BitDepth;
+	switch (PixelData->GetType())
+	{
+	case EImagePixelType::Color: RGBFormat = ERGBFormat::BGRA; BitDepth = 8; break;
+	case EImagePixelType::Float16: RGBFormat = ERGBFormat::RGBAF; BitDepth = 16; break;
+	case EImagePixelType::Float32: RGBFormat = ERGBFormat::RGBAF; BitDepth = 32; break;
+	default: return false;
+	}
+
+	const void* RawData = nullptr;
+	int64 RawDataSize = 0;
+	if (!PixelData->GetRawData(RawData, RawDataSize))
+	{
+		return false;
+	}
+
+	IImageWrapperModule& ImageWrapperModule = FModuleManager::GetModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(WriteTask->Format);
+	const FIntPoint Size = PixelData->GetSize();
+	if (!ImageWrapper.IsValid() || !ImageWrapper->SetRaw(RawData, RawDataSize, Size.X, Size.Y, RGBFormat, BitDepth))
+	{
+		return false;
+	}
+
+	OutData = ImageWrapper->GetCompressed(WriteTask->CompressionQuality);
+	return OutData.Num() > 0;
+}
+
+void UMoviePipelineImageSequenceOutputLocalBase::OnReceiveImageDataImpl(FMoviePipelineMergerOutputFrame* InMergedOutputFrame)
+{
+	check(InMergedOutputFrame);
+
+	// Write tasks run on worker threads, so the module cannot be loaded by them
+	FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+
+	const TCHAR* Extension = FileExtension();
+	for (TPair<FMoviePipelinePassIdentifier, TUniquePtr<FImagePixelData>>& RenderPassData : InMergedOutputFrame->ImageOutputData)
+	{
+		FString FinalFilePath;
+		FString FinalImageSequenceFileName;
+		FString ClipName;
+		ResolveOutputFilePath(InMergedOutputFrame, RenderPassData.Key, Extension, FinalFilePath, FinalImageSequenceFileName, ClipName);
+
+		TUniquePtr<FImageWriteTask> ImageTask = MakeUnique<FImageWriteTask>();
+		ImageTask->Format = OutputFormat;
+		ImageTask->CompressionQuality = 100;
+		ImageTask->Filename = FinalFilePath;
+
+		// Merged frames are shared by all output settings, so the data is copied before it is modified
+		if (OutputFormat == EImageFormat::EXR)
+		{
+			ImageTask->PixelData = RenderPassData.Value->CopyImageData();
+		}
+		else
+		{
+			ImageTask->PixelData = UE::MoviePipeline::QuantizeImagePixelDataToBitDepth(RenderPassData.Value.Get(), 8);
+		}
+
+		FImagePixelDataPayload* Payload = RenderPassData.Value->GetPayload<FImagePixelDataPayload>();
+		if (!Payload->bRequireTransparentOutput)
+		{
+			ImageTask->AddPreProcessorToSetAlphaOpaque();
+		}
+
+		// Packed images are handed to the dataset shard packer by the task instead of being written
+		TUniquePtr<FPackedImageWriteTaskLocal> PackedImageTask = MakeUnique<FPackedImageWriteTaskLocal>(MoveTemp(ImageTask));
+		EnqueueWriteTask(MoveTemp(PackedImageTask), InMergedOutputFrame, RenderPassData.Key, Extension, FinalFilePath, FinalImageSequenceFileName, ClipName);
+	}
+}
+
+void UMoviePipelineImageSequenceOutputLocalBase::ResolveOutputFilePath(
+	FMoviePipelineMergerOutputFrame* InMergedOutputFrame,
+	const FMoviePipelinePassIdentifier& PassIdentifier,
+	const TCHAR* Extension,
+	FString& OutFilePath,
+	FString& OutImageSequenceFileName,
+	FString& OutClipName) const
+{
+	UMoviePipelineOutputSetting* OutputSettings = GetPipeline()->GetPipelinePrimaryConfig()->FindSetting<UMoviePipelineOutputSetting>();
+	check(OutputSettings);
+
+	// Multiple render passes would overwrite each other's files unless the pass name is a part of the file name
+	FString FileNameFormatString = OutputSettings->FileNameFormat;
+	const bool bIncludeRenderPass = (InMergedOutputFrame->ImageOutputData.Num() > 1);
+	const bool bTestFrameNumber = true;
+	UE::MoviePipeline::ValidateOutputFormatString(FileNameFormatString, bIncludeRenderPass, bTestFrameNumber);
+
+	TMap<FString, FString> FormatOverrides;
+	FormatOverrides.Add(TEXT("render_pass"), PassIdentifier.Name);
+	FormatOverrides.Add(TEXT("ext"), Extension);
+
+	FMoviePipelineFormatArgs FinalFormatArgs;
+	GetPipeline()->ResolveFilenameFormatArguments(FileNameFormatString, FormatOverrides, OutImageSequenceFileName, FinalFormatArgs, &InMergedOutputFrame->FrameOutputState, -InMergedOutputFrame->FrameOutputState.ShotOutputFrameNumber);
+
+	const FString FilePathFormatString = OutputSettings->OutputDirectory.Path / FileNameFormatString;
+	GetPipeline()->ResolveFilenameFormatArguments(FilePathFormatString, FormatOverrides, OutFilePath, FinalFormatArgs, &InMergedOutputFrame->FrameOutputState);
+
+	if (FPaths::IsRelative(OutFilePath))
+	{
+		OutFilePath = FPaths::ConvertRelativePathToFull(OutFilePath);
+	}
+
+	// Create a deterministic clip name by removing frame numbers, the file extension, and any trailing dots
+	UE::MoviePipeline::RemoveFrameNumberFormatStrings(FileNameFormatString, true);
+	GetPipeline()->ResolveFilenameFormatArguments(FileNameFormatString, FormatOverrides, OutClipName, FinalFormatArgs, &InMergedOutputFrame->FrameOutputState);
+	OutClipName.RemoveFromEnd(Extension);
+	OutClipName.RemoveFromEnd(".");
+}
+
+void UMoviePipelineImageSequenceOutputLocalBase::EnqueueWriteTask(
+	TUniquePtr<IImageWriteTaskBase>&& WriteTask,
+	FMoviePipelineMergerOutputFrame* InMergedOutputFrame,
+	const FMoviePipelinePassIdentifier& PassIdentifier,
+	const TCHAR* Extension,
+	const FString& FilePath,
+	const FString& ImageSequenceFileName,
+	const FString& ClipName)
+{
+	FImagePixelDataPayload* Payload = InMergedOutputFrame->ImageOutputData[PassIdentifier]->GetPayload<FImagePixelDataPayload>();
+	MoviePipeline::FMoviePipelineOutputFutureData OutputData;
+	OutputData.Shot = GetPipeline()->GetActiveShotList()[Payload->SampleState.OutputState.ShotIndex];
+	OutputData.PassIdentifier = PassIdentifier;
+	OutputData.FilePath = FilePath;
+	GetPipeline()->AddOutputFuture(FRenderManifest::TrackWrite(ImageWriteQueue->Enqueue(MoveTemp(WriteTask)), FilePath), OutputData);
+
+#if WITH_EDITOR
+	GetPipeline()->AddFrameToOutputMetadata(ClipName, ImageSequenceFileName, InMergedOutputFrame->FrameOutputState, Extension, Payload->bRequireTransparentOutput);
+#endif
+}
+
+const TCHAR* UMoviePipelineImageSequenceOutputLocalBase::FileExtension() const
+{
+	switch (OutputFormat)
+	{
+	case EImageFormat::PNG: return TEXT("png");
+	case EImageFormat::JPEG: return TEXT("jpeg");
+	case EImageFormat::BMP: return TEXT("bmp");
+	case EImageFormat::EXR: return TEXT("exr");
+	default: return TEXT("");
+	}
+}
@@ -0,0 +1,111 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ImageWriteTask.h"
+#include "MoviePipelineImageSequenceOutput.h"
+
+#include "MoviePipelineImageOutputLocal.generated.h"
+
+
+/**
+ * Image write task that hands the encoded image to the dataset shard packer when the image is packed,
+ * instead of writing it into its file, and otherwise runs the wrapped write task as it is
+*/
+class FPackedImageWriteTaskLocal : public IImageWriteTaskBase
+{
+public:
+	explicit FPackedImageWriteTaskLocal(TUniquePtr<FImageWriteTask>&& InWriteTask) :
+		WriteTask(MoveTemp(InWriteTask))
+	{}
+
+	virtual bool RunTask() override final;
+	virtual void OnAbandoned() override final { WriteTask->OnAbandoned(); }
+
+private:
+	/** Encodes the image of the write task the same way it would be written into the file */
+	bool EncodeImage(TArray64<uint8>& OutData);
+
+	/** Task writing the image into its file */
+	TUniquePtr<FImageWriteTask> WriteTask;
+};
+
+
+/**
+ * Image sequence output that writes each render pass into its own file like the engine one,
+ * while tracking the write futures so that the renderer learns about each written file
+ * as soon as its write task completes
+ * Burn-in composite passes are not supported, as the renderer does not use them
+*/
+UCLASS(Abstract)
+class UMoviePipelineImageSequenceOutputLocalBase : public UMoviePipelineImageSequenceOutputBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnReceiveImageDataImpl(FMoviePipelineMergerOutputFrame* InMergedOutputFrame) override;
+
+protected:
+	/** Resolves the path of the file the render pass of the merged frame is written to */
+	void ResolveOutputFilePath(
+		FMoviePipelineMergerOutputFrame* InMergedOutputFrame,
+		const FMoviePipelinePassIdentifier& PassIdentifier,
+		const TCHAR* Extension,
+		FString& OutFilePath,
+		FString& OutImageSequenceFileName,
+		FString& OutClipName) const;
+
+	/** Queues the write task of the render pass file, tracking its completion */
+	void EnqueueWriteTask(
+		TUniquePtr<IImageWriteTaskBase>&& WriteTask,
+		FMoviePipelineMergerOutputFrame* InMergedOutputFrame,
+		const FMoviePipelinePassIdentifier& PassIdentifier,
+		const TCHAR* Extension,
+		const FString& FilePath,
+		const FString& ImageSequenceFileName,
+		const FString& ClipName);
+
+	/** Returns the file extension of the output format */
+	const TCHAR* FileExtension() const;
+};
+
+
+/**
+ * Tracked 8-bit JPEG image sequence output
+*/
+UCLASS()
+class UMoviePipelineImageSequenceOutput_JPGLocal : public UMoviePipelineImageSequenceOutputLocalBase
+{
+	GENERATED_BODY()
+
+public:
+#if WITH_EDITOR
+	virtual FText GetDisplayText() const override { return NSLOCTEXT("MovieRenderPipeline", "ImgSequenceJPGLocalSettingDisplayName", ".jpg Sequence [8bit]"); }
+#endif
+
+	UMoviePipelineImageSequenceOutput_JPGLocal()
+	{
+		OutputFormat = EImageFormat::JPEG;
+	}
+};
+
+
+/**
+ * Tracked 8-bit PNG image sequence output
+*/
+UCLASS()
+class UMoviePipelineImageSequenceOutput_PNGLocal : public UMoviePipelineImageSequenceOutputLocalBase
+{
+	GENERATED_BODY()
+
+public:
+#if WITH_EDITOR
+	virtual FText GetDisplayText() const override { return NSLOCTEXT("MovieRenderPipeline", "ImgSequencePNGLocalSettingDisplayName", ".png Sequence [8bit]"); }
+#endif
+
+	UMoviePipelineImageSequenceOutput_PNGLocal()
+	{
+		OutputFormat = EImageFormat::PNG;
+	}
+};
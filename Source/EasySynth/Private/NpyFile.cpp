@@ -0,0 +1,161 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "NpyFile.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+
+#include "EasySynth.h"
+
+
+const uint8 FNpyFile::Magic[6] = { 0x93, 'N', 'U', 'M', 'P', 'Y' };
+const int32 FNpyFile::PreambleSize = sizeof(FNpyFile::Magic) + 4;
+const int32 FNpyFile::MaxDimensionDigits = 20;
+
+TUniquePtr<FArchive> FNpyFile::CreateWriter(const FString& FilePath, const FString& DataType, const TArray<int64>& Shape)
+{
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!Writer.IsValid())
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not open the file %s"), *FString(__FUNCTION__), *FilePath)
+		return nullptr;
+	}
+
+	WriteHeader(*Writer, DataType, Shape);
+	return Writer;
+}
+
+void FNpyFile::UpdateShape(FArchive& Writer, const FString& DataType, const TArray<int64>& Shape)
+{
+	const int64 DataEnd = Writer.Tell();
+	Writer.Seek(0);
+	WriteHeader(Writer, DataType, Shape);
+	Writer.Seek(DataEnd);
+}
+
+bool FNpyFile::Load(const FString& FilePath, FString& OutDataType, TArray<int64>& OutShape, TArray64<uint8>& OutData)
+{
+	if (!FFileHelper::LoadFileToArray(OutData, *FilePath) ||
+		OutData.Num() < PreambleSize ||
+		FMemory::Memcmp(OutData.GetData(), Magic, sizeof(Magic)) != 0)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not read the NumPy array file %s"), *FString(__FUNCTION__), *FilePath)
+		return false;
+	}
+
+	const int32 HeaderSize = OutData[PreambleSize - 2] | (OutData[PreambleSize - 1] << 8);
+	const FString Header(HeaderSize, reinterpret_cast<const ANSICHAR*>(OutData.GetData() + PreambleSize));
+
+	// Only headers written by this class are expected, so fields are found by their exact prefixes
+	FString DataTypeAndRest;
+	FString ShapeAndRest;
+	FString ShapeString;
+	if (!Header.Split(TEXT("'descr': "), nullptr, &DataTypeAndRest) ||
+		!DataTypeAndRest.Split(TEXT(", 'fortran_order'"), &OutDataType, nullptr) ||
+		!Header.Split(TEXT("'shape': ("), nullptr, &ShapeAndRest) ||
+		!ShapeAndRest.Split(TEXT(")"), &ShapeString, nullptr))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Unexpected header of the NumPy array file %s"), *FString(__FUNCTION__), *FilePath)
+		return false;
+	}
+
+	TArray<FString> Dimensions;
+	ShapeString.ParseIntoArray(Dimensions, TEXT(","));
+	OutShape.Empty();
+	for (const FString& Dimension : Dimensions)
+	{
+		OutShape.Add(FCString::Atoi64(*Dimension.TrimStartAndEnd()));
+	}
+
+	OutData.RemoveAt(0, PreambleSize + HeaderSize);
+	return true;
+}
+
+bool FNpyFile::Concatenate(const TArray<FString>& FilePaths, const FString& OutputFilePath)
+{
+	FString DataType;
+	TArray<int64> Shape;
+	TArray64<uint8> Data;
+	for (const FString& FilePath : FilePaths)
+	{
+		FString FileDataType;
+		TArray<int64> FileShape;
+		TArray64<uint8> FileData;
+		if (!Load(FilePath, FileDataType, FileShape, FileData))
+		{
+			return false;
+		}
+		if (Shape.Num() == 0)
+		{
+			DataType = FileDataType;
+			Shape = FileShape;
+			Data = MoveTemp(FileData);
+			continue;
+		}
+
+		bool bShapesMatch = FileDataType == DataType && FileShape.Num() == Shape.Num();
+		for (int32 i = 1; bShapesMatch && i < Shape.Num(); i++)
+		{
+			bShapesMatch = FileShape[i] == Shape[i];
+		}
+		if (!bShapesMatch)
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Array inside %s does not match previous arrays"), *FString(__FUNCTION__), *FilePath)
+			return false;
+		}
+		Shape[0] += FileShape[0];
+		Data.Append(FileData);
+	}
+
+	if (Shape.Num() == 0)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: No arrays to concatenate into %s"), *FString(__FUNCTION__), *OutputFilePath)
+		return false;
+	}
+
+	TUniquePtr<FArchive> Writer = CreateWriter(OutputFilePath, DataType, Shape);
+	if (!Writer.IsValid())
+	{
+		return false;
+	}
+	Writer->Serialize(Data.GetData(), Data.Num());
+	if (!Writer->Close())
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving the file %s"), *FString(__FUNCTION__), *OutputFilePath)
+		return false;
+	}
+
+	return true;
+}
+
+void FNpyFile::WriteHeader(FArchive& Writer, const FString& DataType, const TArray<int64>& Shape)
+{
+	TArray<FString> Dimensions;
+	TArray<FString> MaxDimensions;
+	for (const int64 Dimension : Shape)
+	{
+		Dimensions.Add(LexToString(Dimension));
+		MaxDimensions.Add(FString::ChrN(MaxDimensionDigits, TEXT('0')));
+	}
+	FString Header = HeaderDictionary(DataType, Dimensions);
+
+	// The preamble and the header ended by a new line are padded with spaces to a multiple of 64 bytes,
+	// so that the data is aligned, and the padding is sized for the longest possible shape
+	const int32 MaxHeaderSize = HeaderDictionary(DataType, MaxDimensions).Len() + 1;
+	const int32 PaddedSize = Align(PreambleSize + MaxHeaderSize, 64);
+	Header += FString::ChrN(PaddedSize - PreambleSize - Header.Len() - 1, TEXT(' ')) + TEXT("\n");
+	const uint16 HeaderSize = Header.Len();
+
+	TArray<uint8> Preamble(Magic, sizeof(Magic));
+	Preamble.Append({ 1, 0, uint8(HeaderSize & 0xff), uint8(HeaderSize >> 8) });
+	Writer.Serialize(Preamble.GetData(), Preamble.Num());
+	const FTCHARToUTF8 HeaderUtf8(*Header);
+	Writer.Serialize(const_cast<ANSICHAR*>(HeaderUtf8.Get()), HeaderUtf8.Length());
+}
+
+FString FNpyFile::HeaderDictionary(const FString& DataType, const TArray<FString>& Dimensions)
+{
+	// Single dimension shapes need a trailing comma to be read as tuples
+	const FString ShapeString = (Dimensions.Num() == 1) ? Dimensions[0] + TEXT(",") : FString::Join(Dimensions, TEXT(", "));
+	return FString::Printf(TEXT("{'descr': %s, 'fortran_order': False, 'shape': (%s), }"), *DataType, *ShapeString);
+}
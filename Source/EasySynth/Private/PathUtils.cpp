@@ -15,4 +15,16 @@ const FString FPathUtils::WidgetStateAssetName(TEXT("WidgetStateAsset"));
 const FString FPathUtils::RenderingOutputDirName(TEXT("RenderingOutput"));
 const FString FPathUtils::CameraRigFileName(TEXT("CameraRig.json"));
 const FString FPathUtils::SemanticClassesFileName(TEXT("SemanticClasses.csv"));
+const FString FPathUtils::SemanticClassIndicesFileName(TEXT("SemanticClassIndices.csv"));
 const FString FPathUtils::CameraPosesFileName(TEXT("CameraPoses.csv"));
+const FString FPathUtils::BoundingBoxesFileName(TEXT("BoundingBoxes.npy"));
+const FString FPathUtils::BoundingBoxObjectsFileName(TEXT("BoundingBoxObjects.csv"));
+const FString FPathUtils::ObjectPosesDirName(TEXT("ObjectPoses"));
+const FString FPathUtils::ImuFileName(TEXT("Imu.csv"));
+const FString FPathUtils::TimingsFileName(TEXT("timings.csv"));
+const FString FPathUtils::RenderHistoryFileName(TEXT("RenderHistory.csv"));
+const FString FPathUtils::ExrCodecBenchmarkFileName(TEXT("exr_codec_benchmark.csv"));
+const FString FPathUtils::RenderQueueFileName(TEXT("RenderQueue.json"));
+const FString FPathUtils::ShardsDirName(TEXT("Shards"));
+const FString FPathUtils::DatasetShardsDirName(TEXT("Dataset"));
+const FString FPathUtils::ShardQueueDirName(TEXT("Queue"));
@@ -0,0 +1,124 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "ReadinessScheduler.h"
+
+#include "AssetCompilingManager.h"
+#include "ContentStreaming.h"
+#include "Editor.h"
+#include "ShaderCompiler.h"
+
+#include "EasySynth.h"
+#include "RenderTelemetry.h"
+
+
+const float FReadinessScheduler::DefaultTimeoutSeconds = 30.0f;
+const float FReadinessScheduler::PollIntervalSeconds = 0.1f;
+const float FReadinessScheduler::StallSeconds = 3.0f;
+
+void FReadinessScheduler::Schedule(FSimpleDelegate OnReady, const float Timeout)
+{
+	Cancel();
+
+	ReadyDelegate = OnReady;
+	TimeoutSeconds = Timeout;
+	WaitStartTime = FPlatformTime::Seconds();
+	PreviousNumPendingWork = INDEX_NONE;
+	LastChangeTime = WaitStartTime;
+	bStalled = false;
+
+	// Poll on timer ticks, so the editor gets to process the latest world changes before the first check
+	const bool bLoop = true;
+	GEditor->GetEditorWorldContext().World()->GetTimerManager().SetTimer(
+		PollTimerHandle,
+		FTimerDelegate::CreateRaw(this, &FReadinessScheduler::Poll),
+		PollIntervalSeconds,
+		bLoop);
+}
+
+void FReadinessScheduler::Cancel()
+{
+	if (PollTimerHandle.IsValid())
+	{
+		GEditor->GetEditorWorldContext().World()->GetTimerManager().ClearTimer(PollTimerHandle);
+	}
+	ReadyDelegate.Unbind();
+}
+
+void FReadinessScheduler::Poll()
+{
+	const double CurrentTime = FPlatformTime::Seconds();
+	const double WaitSeconds = CurrentTime - WaitStartTime;
+
+	FString PendingWork;
+	bool bCompilingShaders;
+	const int32 NumPending = NumPendingWork(PendingWork, bCompilingShaders);
+
+	// Progress is measured against the previous check, so a new wave of work, e.g. shader compilations
+	// triggered by the first ones, restarts the measurement instead of being treated as stalled
+	if (NumPending != PreviousNumPendingWork)
+	{
+		PreviousNumPendingWork = NumPending;
+		LastChangeTime = CurrentTime;
+	}
+	else if (!bStalled && NumPending > 0 && !bCompilingShaders && CurrentTime - LastChangeTime >= StallSeconds)
+	{
+		bStalled = true;
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: Pending work stalled at %s, waiting until the %.2fs timeout"),
+			*FString(__FUNCTION__), *PendingWork, TimeoutSeconds)
+	}
+
+	if (NumPending == 0)
+	{
+		UE_LOG(LogEasySynth, Log, TEXT("%s: Engine ready after %.2fs"), *FString(__FUNCTION__), WaitSeconds)
+	}
+	else if (WaitSeconds >= TimeoutSeconds)
+	{
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: Engine not ready after %.2fs, starting anyway with %s pending%s"),
+			*FString(__FUNCTION__), WaitSeconds, *PendingWork, bStalled ? TEXT(", which stalled") : TEXT(""))
+	}
+	else
+	{
+		return;
+	}
+
+	FRenderTelemetry::Get().AddSample(TEXT("WaitForReadiness"), WaitSeconds);
+
+	// Clear the state before executing, as the delegate may schedule again
+	FSimpleDelegate OnReady = ReadyDelegate;
+	Cancel();
+	OnReady.ExecuteIfBound();
+}
+
+int32 FReadinessScheduler::NumPendingWork(FString& OutPendingWork, bool& bOutCompilingShaders)
+{
+	TArray<FString> PendingWork;
+	int32 NumPending = 0;
+
+	// Newly applied post process and semantic materials may still be compiling
+	bOutCompilingShaders = (GShaderCompilingManager != nullptr && GShaderCompilingManager->IsCompiling());
+	if (bOutCompilingShaders)
+	{
+		const int32 RemainingJobs = GShaderCompilingManager->GetNumRemainingJobs();
+		PendingWork.Add(FString::Printf(TEXT("%d shader jobs"), RemainingJobs));
+		NumPending += FMath::Max(RemainingJobs, 1);
+	}
+
+	// Assets such as textures and static meshes are compiled asynchronously as well
+	const int32 RemainingAssets = FAssetCompilingManager::Get().GetNumRemainingAssets();
+	if (RemainingAssets > 0)
+	{
+		PendingWork.Add(FString::Printf(TEXT("%d asset compilations"), RemainingAssets));
+		NumPending += RemainingAssets;
+	}
+
+	// Texture mips requested by the new view should be resident before the first frame
+	const int32 WantingResources = IStreamingManager::Get().GetNumWantingResources();
+	if (WantingResources > 0)
+	{
+		PendingWork.Add(FString::Printf(TEXT("%d streaming requests"), WantingResources));
+		NumPending += WantingResources;
+	}
+
+	OutPendingWork = FString::Join(PendingWork, TEXT(", "));
+	return NumPending;
+}
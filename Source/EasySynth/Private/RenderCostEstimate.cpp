@@ -0,0 +1,121 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "RenderCostEstimate.h"
+
+#include "HAL/FileManager.h"
+
+
+// Ratios are taken on the higher side of typical synthetic images,
+// as underestimating the size is more costly than overestimating it
+const double FRenderCostEstimate::JpegBytesPerPixel = 0.5;
+const double FRenderCostEstimate::PngBytesPerPixel = 2.5;
+const double FRenderCostEstimate::ExrBytesPerPixel = 5.0;
+
+void FRenderCostEstimate::AddTarget(
+	const FString& TargetName,
+	const EImageFormat ImageFormat,
+	const int32 NumOutputs,
+	const FIntPoint& OutputResolution,
+	const FRenderTelemetry::FFrameCost* FrameCost)
+{
+	FTargetEstimate TargetEstimate;
+	TargetEstimate.TargetName = TargetName;
+	TargetEstimate.ImageFormat = ImageFormat;
+	TargetEstimate.NumFiles = int64(NumFrames) * NumCameras * NumOutputs;
+	if (FrameCost != nullptr)
+	{
+		const int64 NumPixels = int64(OutputResolution.X) * OutputResolution.Y;
+		TargetEstimate.NumBytes = TargetEstimate.NumFiles * NumPixels * FrameCost->BytesPerPixel;
+		TargetEstimate.RenderSeconds = int64(NumFrames) * NumCameras * FrameCost->SecondsPerFrame;
+	}
+	else
+	{
+		TargetEstimate.NumBytes = TargetEstimate.NumFiles * EstimateImageBytes(ImageFormat, OutputResolution);
+		TargetEstimate.RenderSeconds = -1.0;
+	}
+	Targets.Add(TargetEstimate);
+
+	TotalFiles += TargetEstimate.NumFiles;
+	TotalBytes += TargetEstimate.NumBytes;
+	if (TargetEstimate.RenderSeconds < 0.0 || TotalRenderSeconds < 0.0)
+	{
+		TotalRenderSeconds = -1.0;
+	}
+	else
+	{
+		TotalRenderSeconds += TargetEstimate.RenderSeconds;
+	}
+}
+
+void FRenderCostEstimate::CheckFreeDiskSpace(const FString& OutputDirectory)
+{
+	// The output directory may not exist yet, so check the closest existing parent
+	FString ExistingDirectory = FPaths::ConvertRelativePathToFull(OutputDirectory);
+	while (!IFileManager::Get().DirectoryExists(*ExistingDirectory) && !FPaths::IsDrive(ExistingDirectory))
+	{
+		const FString ParentDirectory = FPaths::GetPath(ExistingDirectory);
+		if (ParentDirectory.IsEmpty() || ParentDirectory == ExistingDirectory)
+		{
+			break;
+		}
+		ExistingDirectory = ParentDirectory;
+	}
+
+	uint64 TotalDiskBytes = 0;
+	uint64 FreeBytes = 0;
+	if (!FPlatformMisc::GetDiskTotalAndFreeSpace(ExistingDirectory, TotalDiskBytes, FreeBytes))
+	{
+		FreeDiskBytes = -1;
+		bExceedsFreeDiskSpace = false;
+		return;
+	}
+
+	FreeDiskBytes = FreeBytes;
+	bExceedsFreeDiskSpace = (TotalBytes > FreeDiskBytes);
+}
+
+FString FRenderCostEstimate::ToString() const
+{
+	const double BytesPerGigabyte = 1024.0 * 1024.0 * 1024.0;
+
+	const auto DurationString = [](const double Seconds) {
+		return (Seconds >= 0.0) ? FTimespan::FromSeconds(Seconds).ToString(TEXT("%h:%m:%s")) : FString(TEXT("unknown"));
+	};
+
+	TArray<FString> Lines;
+	Lines.Add(FString::Printf(TEXT("%d frames, %d cameras"), NumFrames, NumCameras));
+	for (const FTargetEstimate& Target : Targets)
+	{
+		Lines.Add(FString::Printf(TEXT("%s (%s): %lld files, %.2f GB, render time %s"),
+			*Target.TargetName,
+			*FRenderTelemetry::ImageFormatName(Target.ImageFormat),
+			Target.NumFiles,
+			Target.NumBytes / BytesPerGigabyte,
+			*DurationString(Target.RenderSeconds)));
+	}
+	Lines.Add(FString::Printf(TEXT("Total: %lld files, %.2f GB, render time %s"),
+		TotalFiles, TotalBytes / BytesPerGigabyte, *DurationString(TotalRenderSeconds)));
+
+	if (FreeDiskBytes >= 0)
+	{
+		Lines.Add(FString::Printf(TEXT("Free disk space: %.2f GB"), FreeDiskBytes / BytesPerGigabyte));
+	}
+	if (bExceedsFreeDiskSpace)
+	{
+		Lines.Add(TEXT("WARNING: The estimated output size exceeds the free disk space"));
+	}
+
+	return FString::Join(Lines, LINE_TERMINATOR);
+}
+
+int64 FRenderCostEstimate::EstimateImageBytes(const EImageFormat ImageFormat, const FIntPoint& OutputResolution)
+{
+	const int64 NumPixels = int64(OutputResolution.X) * OutputResolution.Y;
+	switch (ImageFormat)
+	{
+	case EImageFormat::JPEG: return NumPixels * JpegBytesPerPixel;
+	case EImageFormat::PNG: return NumPixels * PngBytesPerPixel;
+	case EImageFormat::EXR: return NumPixels * ExrBytesPerPixel;
+	default: return NumPixels * ExrBytesPerPixel;
+	}
+}
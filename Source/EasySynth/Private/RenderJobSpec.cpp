@@ -0,0 +1,163 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "RenderJobSpec.h"
+
+#include "Materials/Material.h"
+
+#include "EasySynth.h"
+#include "SequenceRenderer.h"
+
+
+namespace
+{
+	/** Target names used inside spec files, ordered as target types */
+	const TArray<FString> TargetNames = {
+		TEXT("color"),
+		TEXT("depth"),
+		TEXT("normal"),
+		TEXT("optical_flow"),
+		TEXT("semantic"),
+		TEXT("custom_pp_material"),
+	};
+
+	/** Image format names used inside spec files */
+	const TMap<FString, EImageFormat> ImageFormats = {
+		{ TEXT("jpeg"), EImageFormat::JPEG },
+		{ TEXT("png"), EImageFormat::PNG },
+		{ TEXT("exr"), EImageFormat::EXR },
+	};
+}
+
+const FString FRenderQueueEntry::StatusPending(TEXT("pending"));
+const FString FRenderQueueEntry::StatusRendering(TEXT("rendering"));
+const FString FRenderQueueEntry::StatusDone(TEXT("done"));
+const FString FRenderQueueEntry::StatusFailed(TEXT("failed"));
+
+FRenderJobSpec::FRenderJobSpec() :
+	camera_poses(false),
+	object_poses(false),
+	bounding_boxes(false),
+	depth_meters(false),
+	optical_flow_pixels(false),
+	semantic_class_indices(false),
+	multilayer_exr(false),
+	dataset_shard_mb(0),
+	imu_rate_hz(0.0f),
+	imu_gyro_noise(0.0f),
+	imu_accel_noise(0.0f),
+	single_pass(false),
+	parallel_rig(false),
+	resume(false)
+{
+	// Fields missing from the spec file keep the default rendering options
+	const FRendererTargetOptions DefaultOptions;
+	depth_range = DefaultOptions.DepthRangeMeters();
+	optical_flow_scale = DefaultOptions.OpticalFlowScale();
+	readiness_timeout = DefaultOptions.ReadinessTimeout();
+}
+
+bool FRenderJobSpec::GetRendererTargetOptions(FRendererTargetOptions& OutTargetOptions) const
+{
+	for (const FRenderJobSpecTarget& Target : targets)
+	{
+		const int TargetType = TargetNames.Find(Target.name.ToLower());
+		if (TargetType == INDEX_NONE)
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Unknown target %s"), *FString(__FUNCTION__), *Target.name)
+			return false;
+		}
+
+		// Keep the default format if none is provided
+		if (!Target.format.IsEmpty())
+		{
+			const EImageFormat* ImageFormat = ImageFormats.Find(Target.format.ToLower());
+			if (ImageFormat == nullptr)
+			{
+				UE_LOG(LogEasySynth, Error, TEXT("%s: Unknown image format %s"), *FString(__FUNCTION__), *Target.format)
+				return false;
+			}
+			OutTargetOptions.SetOutputFormat(TargetType, *ImageFormat);
+		}
+
+		OutTargetOptions.SetSelectedTarget(TargetType, true);
+	}
+
+	if (OutTargetOptions.TargetSelected(FRendererTargetOptions::CUSTOM_PP_MATERIAL))
+	{
+		UMaterial* CustomPPMaterial = LoadObject<UMaterial>(nullptr, *custom_pp_material);
+		if (CustomPPMaterial == nullptr)
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Could not load the custom post process material %s"),
+				*FString(__FUNCTION__), *custom_pp_material)
+			return false;
+		}
+		OutTargetOptions.SetCustomPPMaterialAssetData(FAssetData(CustomPPMaterial));
+	}
+
+	OutTargetOptions.SetExportCameraPoses(camera_poses);
+	OutTargetOptions.SetExportObjectPoses(object_poses);
+	OutTargetOptions.SetExportBoundingBoxes(bounding_boxes);
+	OutTargetOptions.SetDepthRangeMeters(depth_range);
+	OutTargetOptions.SetDepthInMeters(depth_meters);
+	OutTargetOptions.SetOpticalFlowScale(optical_flow_scale);
+	OutTargetOptions.SetOpticalFlowInPixels(optical_flow_pixels);
+	OutTargetOptions.SetSemanticClassIndices(semantic_class_indices);
+	OutTargetOptions.SetMultilayerExr(multilayer_exr);
+	OutTargetOptions.SetDatasetShardSizeMegabytes(dataset_shard_mb);
+	OutTargetOptions.SetImuRateHz(imu_rate_hz);
+	OutTargetOptions.SetImuGyroNoise(imu_gyro_noise);
+	OutTargetOptions.SetImuAccelNoise(imu_accel_noise);
+	OutTargetOptions.SetSinglePassRendering(single_pass);
+	OutTargetOptions.SetParallelRigRendering(parallel_rig);
+	OutTargetOptions.SetResumeRendering(resume);
+	OutTargetOptions.SetReadinessTimeout(readiness_timeout);
+
+	if (!OutTargetOptions.AnyOptionSelected())
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: No rendering targets selected"), *FString(__FUNCTION__))
+		return false;
+	}
+
+	return true;
+}
+
+FRenderJobSpec FRenderJobSpec::FromRendererTargetOptions(const FRendererTargetOptions& TargetOptions)
+{
+	FRenderJobSpec JobSpec;
+
+	for (int TargetType = 0; TargetType < FRendererTargetOptions::COUNT; TargetType++)
+	{
+		if (TargetOptions.TargetSelected(TargetType))
+		{
+			FRenderJobSpecTarget Target;
+			Target.name = TargetNames[TargetType];
+			Target.format = *ImageFormats.FindKey(TargetOptions.OutputFormat(TargetType));
+			JobSpec.targets.Add(Target);
+		}
+	}
+
+	if (TargetOptions.CustomPPMaterial().IsValid())
+	{
+		JobSpec.custom_pp_material = TargetOptions.CustomPPMaterial().GetSoftObjectPath().ToString();
+	}
+
+	JobSpec.camera_poses = TargetOptions.ExportCameraPoses();
+	JobSpec.object_poses = TargetOptions.ExportObjectPoses();
+	JobSpec.bounding_boxes = TargetOptions.ExportBoundingBoxes();
+	JobSpec.depth_range = TargetOptions.DepthRangeMeters();
+	JobSpec.depth_meters = TargetOptions.DepthInMeters();
+	JobSpec.optical_flow_scale = TargetOptions.OpticalFlowScale();
+	JobSpec.optical_flow_pixels = TargetOptions.OpticalFlowInPixels();
+	JobSpec.semantic_class_indices = TargetOptions.SemanticClassIndices();
+	JobSpec.multilayer_exr = TargetOptions.MultilayerExr();
+	JobSpec.dataset_shard_mb = TargetOptions.DatasetShardSizeMegabytes();
+	JobSpec.imu_rate_hz = TargetOptions.ImuRateHz();
+	JobSpec.imu_gyro_noise = TargetOptions.ImuGyroNoise();
+	JobSpec.imu_accel_noise = TargetOptions.ImuAccelNoise();
+	JobSpec.single_pass = TargetOptions.SinglePassRendering();
+	JobSpec.parallel_rig = TargetOptions.ParallelRigRendering();
+	JobSpec.resume = TargetOptions.ResumeRendering();
+	JobSpec.readiness_timeout = TargetOptions.ReadinessTimeout();
+
+	return JobSpec;
+}
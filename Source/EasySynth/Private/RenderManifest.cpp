@@ -0,0 +1,221 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "RenderManifest.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+
+#include "DatasetShardPacker.h"
+#include "EasySynth.h"
+
+
+const FString FRenderManifest::ManifestFileName(TEXT("RenderManifest.csv"));
+const FString FRenderManifest::CompleteMarker(TEXT("complete"));
+TQueue<FRenderManifest::FWrittenFile, EQueueMode::Mpsc> FRenderManifest::WrittenFiles;
+
+bool FRenderManifest::Open(const FString& OutputDirectory, const bool bResume)
+{
+	ManifestFilePath = OutputDirectory / ManifestFileName;
+	RenderedFrames.Empty();
+	CompletedOutputs.Empty();
+	RecordedFiles = 0;
+	RecordedBytes = 0;
+	WrittenFiles.Empty();
+
+	if (!bResume)
+	{
+		IFileManager::Get().Delete(*ManifestFilePath);
+		return true;
+	}
+
+	// A missing manifest means nothing has been rendered yet
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *ManifestFilePath))
+	{
+		UE_LOG(LogEasySynth, Log, TEXT("%s: No manifest found at %s, rendering everything"),
+			*FString(__FUNCTION__), *ManifestFilePath)
+		return true;
+	}
+
+	// Each line has the camera,target,frame format
+	for (const FString& Line : Lines)
+	{
+		TArray<FString> Values;
+		Line.ParseIntoArray(Values, TEXT(","));
+		if (Values.Num() != 3)
+		{
+			// Tolerate a partially written last line
+			continue;
+		}
+
+		const FString OutputKey = Key(Values[0], Values[1]);
+		if (Values[2] == CompleteMarker)
+		{
+			CompletedOutputs.Add(OutputKey);
+		}
+		else if (Values[2].IsNumeric())
+		{
+			RenderedFrames.FindOrAdd(OutputKey).Add(FCString::Atoi(*Values[2]));
+		}
+	}
+
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Resuming with %d complete outputs"),
+		*FString(__FUNCTION__), CompletedOutputs.Num())
+
+	return true;
+}
+
+TFuture<bool> FRenderManifest::TrackWrite(TFuture<bool>&& WriteFuture, const FString& FilePath)
+{
+	// The continuation runs on the thread that completed the write, before the pipeline sees the result
+	return WriteFuture.Next([FilePath](const bool bSuccess)
+	{
+		if (!bSuccess)
+		{
+			return false;
+		}
+
+		// Packed images have no file to measure, so the packer queues them with the size of their encoded data
+		if (!FDatasetShardPacker::IsPacked(FilePath))
+		{
+			AddWrittenFile(FilePath, IFileManager::Get().FileSize(*FilePath));
+		}
+		return true;
+	});
+}
+
+int32 FRenderManifest::RecordWrittenFrames(const TMap<FString, FString>& CameraDirNames)
+{
+	TArray<FString> NewLines;
+	FWrittenFile WrittenFile;
+	while (WrittenFiles.Dequeue(WrittenFile))
+	{
+		// Images are written to the <rig camera dir>/<output name> directory
+		const FString OutputDirectory = FPaths::GetPath(WrittenFile.FilePath);
+		const FString* CameraName = CameraDirNames.Find(FPaths::ConvertRelativePathToFull(FPaths::GetPath(OutputDirectory)));
+		int32 FrameNumber;
+		if (CameraName == nullptr || !ParseFrameNumber(WrittenFile.FilePath, FrameNumber))
+		{
+			continue;
+		}
+
+		const FString OutputName = FPaths::GetCleanFilename(OutputDirectory);
+		bool bAlreadyRecorded;
+		RenderedFrames.FindOrAdd(Key(*CameraName, OutputName)).Add(FrameNumber, &bAlreadyRecorded);
+		if (!bAlreadyRecorded)
+		{
+			NewLines.Add(FString::Printf(TEXT("%s,%s,%d"), **CameraName, *OutputName, FrameNumber));
+			RecordedFiles++;
+			RecordedBytes += FMath::Max<int64>(WrittenFile.NumBytes, 0);
+		}
+	}
+
+	AppendLines(NewLines);
+	return NewLines.Num();
+}
+
+void FRenderManifest::MarkComplete(const FString& CameraName, const FString& OutputName)
+{
+	CompletedOutputs.Add(Key(CameraName, OutputName));
+	AppendLines({ FString::Printf(TEXT("%s,%s,%s"), *CameraName, *OutputName, *CompleteMarker) });
+}
+
+bool FRenderManifest::IsComplete(const FString& CameraName, const FString& OutputName) const
+{
+	return CompletedOutputs.Contains(Key(CameraName, OutputName));
+}
+
+int32 FRenderManifest::NumRenderedFrames(
+	const FString& CameraName,
+	const FString& OutputName,
+	const TRange<int32>& FrameRange) const
+{
+	const TSet<int32>* OutputFrames = RenderedFrames.Find(Key(CameraName, OutputName));
+	if (OutputFrames == nullptr)
+	{
+		return 0;
+	}
+
+	int32 NumFrames = 0;
+	for (const int32 FrameNumber : *OutputFrames)
+	{
+		if (FrameRange.Contains(FrameNumber))
+		{
+			NumFrames++;
+		}
+	}
+	return NumFrames;
+}
+
+TRange<int32> FRenderManifest::MissingFrameRange(
+	const FString& CameraName,
+	const FString& OutputName,
+	const TRange<int32>& FrameRange) const
+{
+	if (IsComplete(CameraName, OutputName))
+	{
+		return TRange<int32>::Empty();
+	}
+
+	const TSet<int32>* OutputFrames = RenderedFrames.Find(Key(CameraName, OutputName));
+	if (OutputFrames == nullptr || OutputFrames->Num() == 0)
+	{
+		return FrameRange;
+	}
+
+	// The movie pipeline renders contiguous ranges, so rendered frames are only skipped at range ends
+	int32 StartFrame = FrameRange.GetLowerBoundValue();
+	int32 EndFrame = FrameRange.GetUpperBoundValue();
+	while (StartFrame < EndFrame && OutputFrames->Contains(StartFrame))
+	{
+		StartFrame++;
+	}
+	while (EndFrame > StartFrame && OutputFrames->Contains(EndFrame - 1))
+	{
+		EndFrame--;
+	}
+
+	if (StartFrame == EndFrame)
+	{
+		return TRange<int32>::Empty();
+	}
+	return TRange<int32>(StartFrame, EndFrame);
+}
+
+bool FRenderManifest::ParseFrameNumber(const FString& FileName, int32& OutFrameNumber)
+{
+	// Movie pipeline file names end with the frame number, e.g. Sequence.0042.jpeg
+	const FString BaseFileName = FPaths::GetBaseFilename(FileName);
+	int32 DigitsStart = BaseFileName.Len();
+	while (DigitsStart > 0 && FChar::IsDigit(BaseFileName[DigitsStart - 1]))
+	{
+		DigitsStart--;
+	}
+	if (DigitsStart == BaseFileName.Len())
+	{
+		return false;
+	}
+
+	OutFrameNumber = FCString::Atoi(*BaseFileName.Mid(DigitsStart));
+	return true;
+}
+
+void FRenderManifest::AppendLines(const TArray<FString>& Lines)
+{
+	if (Lines.Num() == 0 || ManifestFilePath.IsEmpty())
+	{
+		return;
+	}
+
+	const FString Content = FString::Join(Lines, LINE_TERMINATOR) + LINE_TERMINATOR;
+	if (!FFileHelper::SaveStringToFile(
+		Content,
+		*ManifestFilePath,
+		FFileHelper::EEncodingOptions::AutoDetect,
+		&IFileManager::Get(),
+		EFileWrite::FILEWRITE_Append))
+	{
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: Failed while appending to the file %s"),
+			*FString(__FUNCTION__), *ManifestFilePath)
+	}
+}
@@ -0,0 +1,247 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "RenderTelemetry.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+
+#include "EasySynth.h"
+#include "PathUtils.h"
+
+
+const FString FRenderTelemetry::RenderJobStagePrefix(TEXT("RenderJob/"));
+const FString FRenderTelemetry::HistoryHeader(TEXT("target,format,width,height,frames,seconds,files,bytes"));
+
+FRenderTelemetry& FRenderTelemetry::Get()
+{
+	static FRenderTelemetry RenderTelemetry;
+	return RenderTelemetry;
+}
+
+void FRenderTelemetry::Reset()
+{
+	FScopeLock Lock(&StagesCriticalSection);
+	Stages.Empty();
+	StageNames.Empty();
+}
+
+void FRenderTelemetry::AddSample(const FString& StageName, const double Seconds, const int64 Bytes, const int64 Frames)
+{
+	FScopeLock Lock(&StagesCriticalSection);
+	FStageTimings& StageTimings = FindOrAddStage(StageName);
+	StageTimings.Count++;
+	StageTimings.TotalSeconds += Seconds;
+	StageTimings.MinSeconds = FMath::Min(StageTimings.MinSeconds, Seconds);
+	StageTimings.MaxSeconds = FMath::Max(StageTimings.MaxSeconds, Seconds);
+	StageTimings.TotalBytes += Bytes;
+	StageTimings.TotalFrames += Frames;
+}
+
+bool FRenderTelemetry::ExportTimings(const FString& OutputDirectory) const
+{
+	TArray<FString> Lines;
+	Lines.Add(TEXT("stage,count,total_seconds,mean_seconds,min_seconds,max_seconds,total_bytes,total_frames"));
+	{
+		FScopeLock Lock(&StagesCriticalSection);
+		for (const FString& StageName : StageNames)
+		{
+			const FStageTimings& StageTimings = Stages[StageName];
+			Lines.Add(FString::Printf(TEXT("%s,%d,%.6f,%.6f,%.6f,%.6f,%lld,%lld"),
+				*StageName,
+				StageTimings.Count,
+				StageTimings.TotalSeconds,
+				StageTimings.TotalSeconds / StageTimings.Count,
+				StageTimings.MinSeconds,
+				StageTimings.MaxSeconds,
+				StageTimings.TotalBytes,
+				StageTimings.TotalFrames));
+		}
+	}
+
+	const FString FilePath = FPathUtils::TimingsFilePath(OutputDirectory);
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *FilePath))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving the file %s"), *FString(__FUNCTION__), *FilePath)
+		return false;
+	}
+
+	return true;
+}
+
+bool FRenderTelemetry::MergeTimings(const TArray<FString>& FilePaths, const FString& OutputDirectory)
+{
+	FRenderTelemetry MergedTelemetry;
+	const int32 NumColumns = 8;
+	for (const FString& FilePath : FilePaths)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *FilePath))
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Could not read %s"), *FString(__FUNCTION__), *FilePath)
+			return false;
+		}
+
+		for (const FString& Line : Lines)
+		{
+			TArray<FString> Values;
+			Line.ParseIntoArray(Values, TEXT(","));
+			if (Values.Num() != NumColumns || !Values[1].IsNumeric())
+			{
+				// Skip the header
+				continue;
+			}
+
+			FStageTimings& StageTimings = MergedTelemetry.FindOrAddStage(Values[0]);
+			StageTimings.Count += FCString::Atoi(*Values[1]);
+			StageTimings.TotalSeconds += FCString::Atod(*Values[2]);
+			StageTimings.MinSeconds = FMath::Min(StageTimings.MinSeconds, FCString::Atod(*Values[4]));
+			StageTimings.MaxSeconds = FMath::Max(StageTimings.MaxSeconds, FCString::Atod(*Values[5]));
+			StageTimings.TotalBytes += FCString::Atoi64(*Values[6]);
+			StageTimings.TotalFrames += FCString::Atoi64(*Values[7]);
+		}
+	}
+
+	return MergedTelemetry.ExportTimings(OutputDirectory);
+}
+
+FRenderTelemetry::FStageTimings& FRenderTelemetry::FindOrAddStage(const FString& StageName)
+{
+	FStageTimings* StageTimings = Stages.Find(StageName);
+	if (StageTimings == nullptr)
+	{
+		StageNames.Add(StageName);
+		StageTimings = &Stages.Add(StageName);
+	}
+	return *StageTimings;
+}
+
+bool FRenderTelemetry::AppendHistory(
+	const FString& TargetName,
+	const EImageFormat ImageFormat,
+	const FIntPoint& Resolution,
+	const int32 NumFrames,
+	const double Seconds,
+	const int64 NumFiles,
+	const int64 NumBytes)
+{
+	const FString FilePath = FPathUtils::RenderHistoryFilePath();
+
+	// Histories without the format column mix the costs of different formats, so they are started over
+	TArray<FString> ExistingLines;
+	const bool bCurrentHistory =
+		FFileHelper::LoadFileToStringArray(ExistingLines, *FilePath) &&
+		ExistingLines.Num() > 0 &&
+		ExistingLines[0] == HistoryHeader;
+
+	FString Content;
+	if (!bCurrentHistory)
+	{
+		Content += HistoryHeader + LINE_TERMINATOR;
+	}
+	Content += FString::Printf(TEXT("%s,%s,%d,%d,%d,%.6f,%lld,%lld"),
+		*TargetName,
+		*ImageFormatName(ImageFormat),
+		Resolution.X,
+		Resolution.Y,
+		NumFrames,
+		Seconds,
+		NumFiles,
+		NumBytes) + LINE_TERMINATOR;
+
+	if (!FFileHelper::SaveStringToFile(
+		Content,
+		*FilePath,
+		FFileHelper::EEncodingOptions::AutoDetect,
+		&IFileManager::Get(),
+		bCurrentHistory ? EFileWrite::FILEWRITE_Append : EFileWrite::FILEWRITE_None))
+	{
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: Failed while appending to the file %s"), *FString(__FUNCTION__), *FilePath)
+		return false;
+	}
+
+	return true;
+}
+
+bool FRenderTelemetry::LoadFrameCosts(const FIntPoint& Resolution, TMap<FString, FFrameCost>& OutFrameCosts)
+{
+	OutFrameCosts.Empty();
+
+	TArray<FString> Lines;
+	const FString FilePath = FPathUtils::RenderHistoryFilePath();
+	if (!FFileHelper::LoadFileToStringArray(Lines, *FilePath))
+	{
+		return false;
+	}
+
+	// Totals of all jobs of a target and format, and of its jobs with the requested resolution
+	struct FTargetTotals
+	{
+		double Seconds = 0.0;
+		int64 Frames = 0;
+		double ResolutionSeconds = 0.0;
+		int64 ResolutionFrames = 0;
+		int64 Bytes = 0;
+		double FilePixels = 0.0;
+	};
+	TMap<FString, FTargetTotals> Totals;
+
+	const int32 NumColumns = 8;
+	for (const FString& Line : Lines)
+	{
+		TArray<FString> Values;
+		Line.ParseIntoArray(Values, TEXT(","));
+		if (Values.Num() != NumColumns || !Values[4].IsNumeric())
+		{
+			// Skip the header and partially written lines
+			continue;
+		}
+
+		const FIntPoint JobResolution(FCString::Atoi(*Values[2]), FCString::Atoi(*Values[3]));
+		const int64 Frames = FCString::Atoi64(*Values[4]);
+		const double Seconds = FCString::Atod(*Values[5]);
+		const int64 Files = FCString::Atoi64(*Values[6]);
+		if (Frames <= 0 || Files <= 0)
+		{
+			continue;
+		}
+
+		// Keyed the same way as the job names, which join the target name and the format name
+		FTargetTotals& TargetTotals = Totals.FindOrAdd(Values[0] / Values[1]);
+		TargetTotals.Seconds += Seconds;
+		TargetTotals.Frames += Frames;
+		if (JobResolution == Resolution)
+		{
+			TargetTotals.ResolutionSeconds += Seconds;
+			TargetTotals.ResolutionFrames += Frames;
+		}
+
+		// File sizes scale with the number of pixels, so jobs of any resolution are used
+		TargetTotals.Bytes += FCString::Atoi64(*Values[7]);
+		TargetTotals.FilePixels += double(Files) * JobResolution.X * JobResolution.Y;
+	}
+
+	for (const TPair<FString, FTargetTotals>& Target : Totals)
+	{
+		const FTargetTotals& TargetTotals = Target.Value;
+		FFrameCost FrameCost;
+		FrameCost.SecondsPerFrame = (TargetTotals.ResolutionFrames > 0) ?
+			TargetTotals.ResolutionSeconds / TargetTotals.ResolutionFrames :
+			TargetTotals.Seconds / TargetTotals.Frames;
+		FrameCost.BytesPerPixel = (TargetTotals.FilePixels > 0.0) ? TargetTotals.Bytes / TargetTotals.FilePixels : 0.0;
+		OutFrameCosts.Add(Target.Key, FrameCost);
+	}
+
+	return OutFrameCosts.Num() > 0;
+}
+
+FString FRenderTelemetry::ImageFormatName(const EImageFormat ImageFormat)
+{
+	switch (ImageFormat)
+	{
+	case EImageFormat::JPEG: return TEXT("jpeg");
+	case EImageFormat::PNG: return TEXT("png");
+	case EImageFormat::EXR: return TEXT("exr");
+	default: return TEXT("unknown");
+	}
+}
@@ -0,0 +1,277 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "RendererTargets/BoundingBoxExporter.h"
+
+#include "Async/ParallelFor.h"
+#include "Camera/CameraComponent.h"
+#include "Editor.h"
+#include "ISequencer.h"
+#include "Kismet/GameplayStatics.h"
+#include "MovieScene.h"
+
+#include "CameraRig/CameraRigRosInterface.h"
+#include "EasySynth.h"
+#include "NpyFile.h"
+#include "PathUtils.h"
+#include "TextureStyles/TextureStyleManager.h"
+
+
+const FString FBoundingBoxExporter::RecordDataType(TEXT(
+	"[('frame', '<i4'), ('object', '<i4'), ('center', '<f8', (3,)), ('extent', '<f4', (3,)), "
+	"('rotation', '<f4', (4,)), ('box_2d', '<f4', (4,)), ('depth', '<f4')]"));
+const double FBoundingBoxExporter::NearPlaneDistance = 1.0;
+
+static_assert(sizeof(float) == 4 && sizeof(double) == 8, "Box records require 32-bit floats and 64-bit doubles");
+
+bool FBoundingBoxExporter::ExportBoundingBoxes(
+	ULevelSequence* LevelSequence,
+	const FIntPoint OutputImageResolution,
+	const FString& OutputDir,
+	const TArray<UCameraComponent*>& RigCameras,
+	const UTextureStyleManager* TextureStyleManager)
+{
+	// Records are written as they are laid out in memory, so they must not contain any padding
+	static_assert(sizeof(FBoundingBoxRecord) == 80, "Box records must match the written data type");
+
+	// Open the received level sequence inside the sequencer wrapper
+	if (!SequencerWrapper.OpenSequence(LevelSequence))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Sequencer wrapper opening failed"), *FString(__FUNCTION__))
+		return false;
+	}
+
+	if (!FindLabeledActors(TextureStyleManager))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not find labeled actors"), *FString(__FUNCTION__))
+		return false;
+	}
+	FSequenceFrameEvaluator::CollectFrameTicks(SequencerWrapper, FrameRange, Frames);
+
+	// Actors are described by the same table as posed objects
+	TArray<FObjectPoseExporter::FObjectDescription> ActorDescriptions;
+	for (const FLabeledActor& LabeledActor : LabeledActors)
+	{
+		ActorDescriptions.Add(LabeledActor.Description);
+	}
+	if (!FObjectPoseExporter::SaveObjectsToCSV(FPathUtils::BoundingBoxObjectsFilePath(OutputDir), ActorDescriptions))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving labeled actors to the file"), *FString(__FUNCTION__))
+		return false;
+	}
+
+	// The number of visible boxes is known once all frames are processed, so the file headers are updated at the end
+	const int32 NumActors = LabeledActors.Num();
+	const int32 NumCameras = RigCameras.Num();
+	TArray<TArray<double>> CameraIntrinsics;
+	TArray<TUniquePtr<FArchive>> Writers;
+	for (UCameraComponent* RigCamera : RigCameras)
+	{
+		CameraIntrinsics.Add(FCameraRigRosInterface::CameraIntrinsics(RigCamera, OutputImageResolution));
+		Writers.Add(FNpyFile::CreateWriter(FPathUtils::BoundingBoxesFilePath(OutputDir, RigCamera), RecordDataType, { 0 }));
+		if (!Writers.Last().IsValid())
+		{
+			return false;
+		}
+	}
+
+	ISequencer* Sequencer = SequencerWrapper.GetSequencer();
+	const FFrameTime OriginalTime = Sequencer->GetGlobalTime().Time;
+
+	TArray<FTransform> ActorTransforms;
+	ActorTransforms.SetNum(NumActors);
+	TArray<FTransform> CameraTransforms;
+	CameraTransforms.SetNum(NumCameras);
+	TArray<TArray<FBoundingBoxRecord>> Records;
+	TArray<TArray<bool>> Visible;
+	Records.SetNum(NumCameras);
+	Visible.SetNum(NumCameras);
+	for (int32 CameraId = 0; CameraId < NumCameras; CameraId++)
+	{
+		Records[CameraId].SetNumUninitialized(NumActors);
+		Visible[CameraId].SetNumZeroed(NumActors);
+	}
+	TArray<int64> NumRecords;
+	NumRecords.SetNumZeroed(NumCameras);
+
+	for (int32 FrameIndex = 0; FrameIndex < Frames.TickNumbers.Num(); FrameIndex++)
+	{
+		// The whole sequence is evaluated, so that attached actors follow their parents,
+		// and transforms are read on the game thread before boxes are computed
+		Sequencer->SetGlobalTime(Frames.TickNumbers[FrameIndex]);
+		Sequencer->ForceEvaluate();
+		for (int32 ActorId = 0; ActorId < NumActors; ActorId++)
+		{
+			ActorTransforms[ActorId] = LabeledActors[ActorId].Actor->GetActorTransform();
+		}
+		for (int32 CameraId = 0; CameraId < NumCameras; CameraId++)
+		{
+			CameraTransforms[CameraId] = RigCameras[CameraId]->GetComponentTransform();
+			CameraTransforms[CameraId].SetScale3D(FVector::OneVector);
+		}
+
+		// Boxes of all actors are computed on worker threads, each actor filling its own record of each camera
+		const int32 FrameNumber = Frames.FrameNumbers[FrameIndex];
+		ParallelFor(NumActors, [this, FrameNumber, NumCameras, OutputImageResolution,
+			&ActorTransforms, &CameraTransforms, &CameraIntrinsics, &Records, &Visible](const int32 ActorId)
+		{
+			const FTransform& ActorTransform = ActorTransforms[ActorId];
+			const FBox& LocalBounds = LabeledActors[ActorId].LocalBounds;
+			FVector Corners[8];
+			for (int32 i = 0; i < 8; i++)
+			{
+				Corners[i] = ActorTransform.TransformPosition(FVector(
+					(i & 1) ? LocalBounds.Max.X : LocalBounds.Min.X,
+					(i & 2) ? LocalBounds.Max.Y : LocalBounds.Min.Y,
+					(i & 4) ? LocalBounds.Max.Z : LocalBounds.Min.Z));
+			}
+			const FVector Center = ActorTransform.TransformPosition(LocalBounds.GetCenter());
+			const FVector Extent = LocalBounds.GetExtent() * ActorTransform.GetScale3D().GetAbs();
+			const FQuat Rotation = ActorTransform.GetRotation();
+
+			for (int32 CameraId = 0; CameraId < NumCameras; CameraId++)
+			{
+				FBox2D Box;
+				Visible[CameraId][ActorId] =
+					ProjectBox(Corners, CameraTransforms[CameraId], CameraIntrinsics[CameraId], OutputImageResolution, Box);
+				if (!Visible[CameraId][ActorId])
+				{
+					continue;
+				}
+
+				FBoundingBoxRecord& Record = Records[CameraId][ActorId];
+				Record.Frame = FrameNumber;
+				Record.Object = ActorId;
+				Record.Center[0] = Center.X;
+				Record.Center[1] = Center.Y;
+				Record.Center[2] = Center.Z;
+				Record.Extent[0] = Extent.X;
+				Record.Extent[1] = Extent.Y;
+				Record.Extent[2] = Extent.Z;
+				Record.Rotation[0] = Rotation.X;
+				Record.Rotation[1] = Rotation.Y;
+				Record.Rotation[2] = Rotation.Z;
+				Record.Rotation[3] = Rotation.W;
+				Record.Box2D[0] = Box.Min.X;
+				Record.Box2D[1] = Box.Min.Y;
+				Record.Box2D[2] = Box.Max.X;
+				Record.Box2D[3] = Box.Max.Y;
+				Record.Depth = CameraTransforms[CameraId].InverseTransformPositionNoScale(Center).X;
+			}
+		});
+
+		// Only boxes visible inside a camera are written into its file
+		for (int32 CameraId = 0; CameraId < NumCameras; CameraId++)
+		{
+			for (int32 ActorId = 0; ActorId < NumActors; ActorId++)
+			{
+				if (Visible[CameraId][ActorId])
+				{
+					Writers[CameraId]->Serialize(&Records[CameraId][ActorId], sizeof(FBoundingBoxRecord));
+					NumRecords[CameraId]++;
+				}
+			}
+		}
+	}
+
+	// Return the level to the state it had before the export
+	Sequencer->SetGlobalTime(OriginalTime);
+
+	bool bSaved = true;
+	for (int32 CameraId = 0; CameraId < NumCameras; CameraId++)
+	{
+		FNpyFile::UpdateShape(*Writers[CameraId], RecordDataType, { NumRecords[CameraId] });
+		bSaved &= Writers[CameraId]->Close();
+	}
+	if (!bSaved)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving bounding boxes to files"), *FString(__FUNCTION__))
+		return false;
+	}
+
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Exported bounding boxes of %d actors for %d frames"),
+		*FString(__FUNCTION__), NumActors, Frames.TickNumbers.Num())
+	return true;
+}
+
+bool FBoundingBoxExporter::FindLabeledActors(const UTextureStyleManager* TextureStyleManager)
+{
+	TArray<AActor*> LevelActors;
+	UGameplayStatics::GetAllActorsOfClass(GEditor->GetEditorWorldContext().World(), AActor::StaticClass(), LevelActors);
+	for (AActor* Actor : LevelActors)
+	{
+		// Actors of the undefined class are not labeled, even though they have a class assigned
+		const FString ClassName = TextureStyleManager->ActorClassName(Actor->GetActorGuid());
+		if (ClassName.IsEmpty() || ClassName == UTextureStyleManager::UndefinedSemanticClassName)
+		{
+			continue;
+		}
+
+		// Bounds are calculated inside the actor space, so that boxes rotate together with their actors
+		const bool bNonColliding = true;
+		const bool bIncludeFromChildActors = true;
+		const FBox LocalBounds = Actor->CalculateComponentsBoundingBoxInLocalSpace(bNonColliding, bIncludeFromChildActors);
+		if (!LocalBounds.IsValid)
+		{
+			continue;
+		}
+
+		LabeledActors.Add(FLabeledActor{ Actor, { Actor->GetActorLabel(), Actor->GetActorGuid(), ClassName }, LocalBounds });
+	}
+
+	// Actor ids do not depend on the order actors are stored in, e.g. when shards load the level separately
+	LabeledActors.Sort([](const FLabeledActor& A, const FLabeledActor& B) { return A.Description.ActorGuid < B.Description.ActorGuid; });
+
+	return true;
+}
+
+bool FBoundingBoxExporter::ProjectBox(
+	const FVector (&Corners)[8],
+	const FTransform& CameraTransform,
+	const TArray<double>& Intrinsics,
+	const FIntPoint& ImageResolution,
+	FBox2D& OutBox)
+{
+	// Inside the camera space X points forward, Y to the right and Z up, while image rows go down
+	FVector CameraCorners[8];
+	for (int32 i = 0; i < 8; i++)
+	{
+		CameraCorners[i] = CameraTransform.InverseTransformPositionNoScale(Corners[i]);
+	}
+	OutBox = FBox2D(ForceInit);
+	auto AddPoint = [&OutBox, &Intrinsics](const FVector& Point)
+	{
+		OutBox += FVector2D(
+			Intrinsics[2] + Intrinsics[0] * Point.Y / Point.X,
+			Intrinsics[5] - Intrinsics[4] * Point.Z / Point.X);
+	};
+
+	// Corners behind the near plane are replaced by intersections of the box edges with the near plane
+	for (int32 i = 0; i < 8; i++)
+	{
+		if (CameraCorners[i].X >= NearPlaneDistance)
+		{
+			AddPoint(CameraCorners[i]);
+		}
+
+		// Edges connect corners that differ along a single axis
+		for (const int32 Axis : { 1, 2, 4 })
+		{
+			const int32 j = i | Axis;
+			const FVector& A = CameraCorners[i];
+			const FVector& B = CameraCorners[j];
+			if (j != i && (A.X < NearPlaneDistance) != (B.X < NearPlaneDistance))
+			{
+				AddPoint(A + (B - A) * ((NearPlaneDistance - A.X) / (B.X - A.X)));
+			}
+		}
+	}
+	if (!OutBox.bIsValid)
+	{
+		return false;
+	}
+
+	// Boxes are clipped by the image borders
+	OutBox.Min = FVector2D::Max(OutBox.Min, FVector2D::ZeroVector);
+	OutBox.Max = FVector2D::Min(OutBox.Max, FVector2D(ImageResolution));
+	return OutBox.Min.X < OutBox.Max.X && OutBox.Min.Y < OutBox.Max.Y;
+}
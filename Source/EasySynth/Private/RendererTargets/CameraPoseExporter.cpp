@@ -3,8 +3,11 @@
 #include "RendererTargets/CameraPoseExporter.h"
 
 #include "Camera/CameraComponent.h"
+#include "Async/ParallelFor.h"
 #include "EntitySystem/Interrogation/MovieSceneInterrogationLinker.h"
 #include "EntitySystem/MovieSceneEntitySystemTypes.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
 #include "ILevelSequenceEditorToolkit.h"
 #include "ISequencer.h"
 #include "Kismet/KismetMathLibrary.h"
@@ -17,14 +20,21 @@
 #include "Tracks/MovieScene3DTransformTrack.h"
 
 #include "EasySynth.h"
+#include "RendererTargets/SequenceFrameEvaluator.h"
 
 
+const int32 FCameraPoseExporter::ImuNoiseSeed = 0;
+const double FCameraPoseExporter::StandardGravity = 9.80665;
+
 bool FCameraPoseExporter::ExportCameraPoses(
 	ULevelSequence* LevelSequence,
 	const FIntPoint OutputImageResolution,
 	const FString& OutputDir,
-	UCameraComponent* CameraComponent)
+	const TArray<UCameraComponent*>& RigCameras,
+	const TArray<FTransform>& RenderingCameraTransforms)
 {
+	check(RigCameras.Num() > 0 && RigCameras.Num() == RenderingCameraTransforms.Num())
+
 	// Open the received level sequence inside the sequencer wrapper
 	if (!SequencerWrapper.OpenSequence(LevelSequence))
 	{
@@ -35,24 +45,50 @@ bool FCameraPoseExporter::ExportCameraPoses(
 	OutputResolution = OutputImageResolution;
 
 	// Extract the camera pose transforms
-	const bool bAccumulateCameraOffset = (CameraComponent != nullptr);
-	if (!ExtractCameraTransforms(bAccumulateCameraOffset))
+	if (!ExtractCameraTransforms())
 	{
 		UE_LOG(LogEasySynth, Error, TEXT("%s: Camera pose extraction failed"), *FString(__FUNCTION__))
 		return false;
 	}
 
-	// Store to file
-	FString SaveFilePath;
-	if (CameraComponent == nullptr)
+	// Store rig poses to file
+	if (!SavePosesToCSV(FPathUtils::CameraRigPosesFilePath(OutputDir), CameraTransforms))
 	{
-		SaveFilePath = FPathUtils::CameraRigPosesFilePath(OutputDir);
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving camera rig poses to the file"), *FString(__FUNCTION__))
+		return false;
 	}
-	else
+
+	// Camera names are resolved up front, so that worker threads do not access the components
+	TArray<FString> SaveFilePaths;
+	for (UCameraComponent* RigCamera : RigCameras)
 	{
-		SaveFilePath = FPathUtils::CameraPosesFilePath(OutputDir, CameraComponent);
+		SaveFilePaths.Add(FPathUtils::CameraPosesFilePath(OutputDir, RigCamera));
 	}
-	if (!SavePosesToCSV(SaveFilePath))
+
+	// The first rig camera is the one used for rendering, it is the only one that changes between rig cameras
+	UCameraComponent* RenderingCamera = RigCameras[0];
+	TArray<bool> Saved;
+	Saved.SetNumZeroed(RigCameras.Num());
+	ParallelFor(RigCameras.Num(), [this, RenderingCamera, &RenderingCameraTransforms, &SaveFilePaths, &Saved](const int32 RigCameraId)
+	{
+		TArray<FTransform> Transforms;
+		Transforms.Reserve(CameraTransforms.Num());
+		int32 PoseIndex = 0;
+		for (const FPoseSection& PoseSection : PoseSections)
+		{
+			const FTransform& CameraTransform = (PoseSection.Camera == RenderingCamera) ?
+				RenderingCameraTransforms[RigCameraId] :
+				PoseSection.CameraTransform;
+			for (int32 i = 0; i < PoseSection.NumPoses; i++)
+			{
+				FTransform& Transform = Transforms.Add_GetRef(CameraTransforms[PoseIndex++]);
+				Transform.Accumulate(CameraTransform);
+			}
+		}
+		Saved[RigCameraId] = SavePosesToCSV(SaveFilePaths[RigCameraId], Transforms);
+	});
+
+	if (Saved.Contains(false))
 	{
 		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving camera poses to the file"), *FString(__FUNCTION__))
 		return false;
@@ -61,25 +97,20 @@ bool FCameraPoseExporter::ExportCameraPoses(
 	return true;
 }
 
-bool FCameraPoseExporter::ExtractCameraTransforms(const bool bAccumulateCameraOffset)
+bool FCameraPoseExporter::ExtractCameraTransforms()
 {
-	// Get level sequence fps
-	const FFrameRate DisplayRate = SequencerWrapper.GetMovieScene()->GetDisplayRate();
-	const double FrameTime = 1.0f / DisplayRate.AsDecimal();
-	double AccumulatedFrameTime = 0.0f;
-
-	// Get level sequence ticks per second
-	// Engine likes to update much more often than the video frame rate,
-	// so this is needed to calculate engine ticks that correspond to frames
-	const FFrameRate TickResolutions = SequencerWrapper.GetMovieScene()->GetTickResolution();
-
-	// Calculate ticks per frame
-	const int TicksPerFrame = TickResolutions.AsDecimal() / DisplayRate.AsDecimal();
+	// Collect ticks of all frames first, so that the track of each cut section is evaluated for its frames at once
+	FSequenceFrameEvaluator::FFrames Frames;
+	FSequenceFrameEvaluator::CollectFrameTicks(SequencerWrapper, FrameRange, Frames);
+	Timestamps = Frames.Timestamps;
 
 	// Get the camera poses from each cut section
 	TArray<UMovieSceneCameraCutSection*>& CutSections = SequencerWrapper.GetMovieSceneCutSections();
-	for (auto CutSection : CutSections)
+	int32 SectionStartIndex = 0;
+	for (int32 SectionId = 0; SectionId < CutSections.Num(); SectionId++)
 	{
+		UMovieSceneCameraCutSection* CutSection = CutSections[SectionId];
+
 		// Get the camera component
 		UCameraComponent* Camera = CutSection->GetFirstCamera(
 			*SequencerWrapper.GetSequencer(),
@@ -90,96 +121,405 @@ bool FCameraPoseExporter::ExtractCameraTransforms(const bool bAccumulateCameraOf
 			return false;
 		}
 
-		// Get the current cut section camera binding id
-		const FMovieSceneObjectBindingID& CameraBindingID = CutSection->GetCameraBindingID();
-
 		// Find the track inside the level sequence that corresponds to the
 		// pose transformation of the camera
-		UMovieScene3DTransformTrack* CameraTransformTrack = nullptr;
-		for (const FMovieSceneBinding& Binding : SequencerWrapper.GetMovieScene()->GetBindings())
+		UMovieScene3DTransformTrack* CameraTransformTrack = FindCameraTransformTrack(CutSection);
+		if (CameraTransformTrack == nullptr)
 		{
-			if (Binding.GetObjectGuid() == CameraBindingID.GetGuid())
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Could not find camera transform track"), *FString(__FUNCTION__))
+			return false;
+		}
+
+		// Get the camera pose transforms for the frames of the cut section
+		const TConstArrayView<FFrameTime> TickNumbers(
+			Frames.TickNumbers.GetData() + SectionStartIndex, Frames.SectionNumFrames[SectionId]);
+		SectionStartIndex += Frames.SectionNumFrames[SectionId];
+		TArray<FTransform> SectionTransforms;
+		const bool bEvaluated = bBatchedEvaluation ?
+			FSequenceFrameEvaluator::EvaluateTransformTrack(CameraTransformTrack, TickNumbers, SectionTransforms) :
+			EvaluateTransformsPerFrame(CameraTransformTrack, TickNumbers, SectionTransforms);
+		if (!bEvaluated)
+		{
+			return false;
+		}
+
+		// The relative transform of the camera is accumulated when poses of a specific camera are saved
+		PoseSections.Add(FPoseSection{ Camera, Camera->GetRelativeTransform(), SectionTransforms.Num() });
+		CameraTransforms.Append(SectionTransforms);
+	}
+
+	return true;
+}
+
+bool FCameraPoseExporter::ExportImuSamples(
+	ULevelSequence* LevelSequence,
+	const FString& OutputDir,
+	const double SampleRateHz,
+	const double GyroNoise,
+	const double AccelNoise)
+{
+	check(SampleRateHz > 0.0)
+
+	// Open the received level sequence inside the sequencer wrapper
+	if (!SequencerWrapper.OpenSequence(LevelSequence))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Sequencer wrapper opening failed"), *FString(__FUNCTION__))
+		return false;
+	}
+
+	// Samples are written while they are computed, so that long sequences do not have to fit in memory as text
+	const FString FilePath = FPathUtils::ImuFilePath(OutputDir);
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!FileWriter.IsValid())
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not open the file %s"), *FString(__FUNCTION__), *FilePath)
+		return false;
+	}
+	auto WriteLine = [&FileWriter](const FString& Line)
+	{
+		const FTCHARToUTF8 Utf8Line(*(Line + LINE_TERMINATOR));
+		FileWriter->Serialize(const_cast<ANSICHAR*>(Utf8Line.Get()), Utf8Line.Length());
+	};
+	// Positions keep the centimeters of camera pose files, while derivatives are in meters,
+	// so the header names the unit of each column
+	WriteLine(TEXT("t_s,tx_cm,ty_cm,tz_cm,qx,qy,qz,qw,")
+		TEXT("vx_m_s,vy_m_s,vz_m_s,wx_rad_s,wy_rad_s,wz_rad_s,ax_m_s2,ay_m_s2,az_m_s2,")
+		TEXT("gyro_x_rad_s,gyro_y_rad_s,gyro_z_rad_s,accel_x_m_s2,accel_y_m_s2,accel_z_m_s2"));
+
+	const FFrameRate DisplayRate = SequencerWrapper.GetMovieScene()->GetDisplayRate();
+	const FFrameRate TickResolutions = SequencerWrapper.GetMovieScene()->GetTickResolution();
+	const double FrameTime = 1.0f / DisplayRate.AsDecimal();
+	const int TicksPerFrame = TickResolutions.AsDecimal() / DisplayRate.AsDecimal();
+	const double TicksPerSample = TickResolutions.AsDecimal() / SampleRateHz;
+	const double SampleTime = 1.0 / SampleRateHz;
+
+	// Specific force measured by a resting accelerometer points up
+	const FVector UpForce(0.0, 0.0, StandardGravity);
+
+	// Sample timestamps continue the camera pose timestamps, which start at the first frame time
+	double SectionStartTime = FrameTime;
+	// Index of the first section sample among samples of the whole sequence
+	int64 SectionFirstSequenceSample = 0;
+	for (UMovieSceneCameraCutSection* CutSection : SequencerWrapper.GetMovieSceneCutSections())
+	{
+		const FFrameNumber StartTickNumber = CutSection->GetTrueRange().GetLowerBoundValue();
+		const FFrameNumber EndTickNumber = CutSection->GetTrueRange().GetUpperBoundValue();
+		const double SectionTime = FMath::DivideAndRoundUp(EndTickNumber.Value - StartTickNumber.Value, TicksPerFrame) * FrameTime;
+		const int64 NumSectionSamples = FMath::CeilToInt64((EndTickNumber.Value - StartTickNumber.Value) / TicksPerSample);
+
+		// Find samples inside the requested frame range
+		int64 FirstSample = INDEX_NONE;
+		int64 LastSample = INDEX_NONE;
+		for (int64 Sample = 0; Sample < NumSectionSamples; Sample++)
+		{
+			const FFrameTime SampleTick = FFrameTime::FromDecimal(StartTickNumber.Value + Sample * TicksPerSample);
+			const int32 FrameNumber = FFrameRate::TransformTime(SampleTick, TickResolutions, DisplayRate).FloorToFrame().Value;
+			if (FrameRange.Contains(FrameNumber))
 			{
-				for (UMovieSceneTrack* Track : Binding.GetTracks())
-				{
-					CameraTransformTrack = Cast<UMovieScene3DTransformTrack>(Track);
-					if (CameraTransformTrack != nullptr)
-					{
-						break;
-					}
-				}
+				FirstSample = (FirstSample == INDEX_NONE) ? Sample : FirstSample;
+				LastSample = Sample;
 			}
 		}
+		if (FirstSample == INDEX_NONE)
+		{
+			SectionStartTime += SectionTime;
+			SectionFirstSequenceSample += NumSectionSamples;
+			continue;
+		}
+
+		UMovieScene3DTransformTrack* CameraTransformTrack = FindCameraTransformTrack(CutSection);
 		if (CameraTransformTrack == nullptr)
 		{
 			UE_LOG(LogEasySynth, Error, TEXT("%s: Could not find camera transform track"), *FString(__FUNCTION__))
 			return false;
 		}
 
-		// Interrogator object that queries the transformation track for camera poses
-		UE::MovieScene::FSystemInterrogator Interrogator;
+		// One more sample is evaluated on each side of the range, so that finite differences
+		// do not depend on where the range ends, e.g. when the rendering is split into shards
+		const int64 FirstEvaluatedSample = FMath::Max<int64>(FirstSample - 1, 0);
+		const int64 LastEvaluatedSample = FMath::Min<int64>(LastSample + 1, NumSectionSamples - 1);
+
+		// Interrogating the track for each sample is too slow at IMU rates, so the track is evaluated
+		// at the section frames and samples are interpolated in between, holding the last frame pose
+		// until the section end
+		const int32 NumSectionFrames = FMath::DivideAndRoundUp(EndTickNumber.Value - StartTickNumber.Value, TicksPerFrame);
+		auto SampleFramePosition = [&](const int64 Sample)
+		{
+			return FMath::Min(Sample * TicksPerSample / TicksPerFrame, double(NumSectionFrames - 1));
+		};
+		const int32 FirstEvaluatedFrame = FMath::Max(FMath::FloorToInt32(SampleFramePosition(FirstEvaluatedSample)) - 1, 0);
+		const int32 LastEvaluatedFrame = FMath::Min(
+			FMath::FloorToInt32(SampleFramePosition(LastEvaluatedSample)) + 2, NumSectionFrames - 1);
+		TArray<FFrameTime> FrameTicks;
+		for (int32 Frame = FirstEvaluatedFrame; Frame <= LastEvaluatedFrame; Frame++)
+		{
+			FrameTicks.Add(FFrameTime(StartTickNumber + Frame * TicksPerFrame));
+		}
+		TArray<FTransform> FrameTransforms;
+		if (!FSequenceFrameEvaluator::EvaluateTransformTrack(CameraTransformTrack, FrameTicks, FrameTransforms))
+		{
+			return false;
+		}
+
+		TArray<FTransform> Transforms;
+		for (int64 Sample = FirstEvaluatedSample; Sample <= LastEvaluatedSample; Sample++)
+		{
+			Transforms.Add(InterpolateTransform(FrameTransforms, SampleFramePosition(Sample) - FirstEvaluatedFrame));
+		}
 
-		// Inclusive lower bound of the movie scene ticks that belong to this cut section
-		FFrameNumber StartTickNumber = CutSection->GetTrueRange().GetLowerBoundValue();
-		// Exclusive upper bound of the movie scene ticks that belong to this cut section
-		FFrameNumber EndTickNumber = CutSection->GetTrueRange().GetUpperBoundValue();
-		for (FFrameNumber TickNumber = StartTickNumber; TickNumber < EndTickNumber; TickNumber += TicksPerFrame)
+		// Derivatives use positions in meters, while poses keep the centimeters of camera pose files
+		const int32 NumTransforms = Transforms.Num();
+		for (int64 Sample = FirstSample; Sample <= LastSample; Sample++)
 		{
-			// Reinitialize the interrogator for each frame
-			Interrogator.Reset();
-			TGuardValue<UE::MovieScene::FEntityManager*> DebugVizGuard(
-				UE::MovieScene::GEntityManagerForDebuggingVisualizers, &Interrogator.GetLinker()->EntityManager);
-			Interrogator.ImportTrack(CameraTransformTrack, UE::MovieScene::FInterrogationChannel::Default());
+			const int32 Current = Sample - FirstEvaluatedSample;
+			const int32 Previous = FMath::Max(Current - 1, 0);
+			const int32 Next = FMath::Min(Current + 1, NumTransforms - 1);
 
-			// Add frame interrogation
-			if (Interrogator.AddInterrogation(TickNumber) == INDEX_NONE)
+			// Central differences, falling back to one sided ones at section ends
+			FVector Velocity = FVector::ZeroVector;
+			FVector AngularVelocity = FVector::ZeroVector;
+			if (Next > Previous)
 			{
-				UE_LOG(LogEasySynth, Error, TEXT("%s: Adding interrogation failed"), *FString(__FUNCTION__))
-				return false;
+				const double DeltaTime = (Next - Previous) * SampleTime;
+				Velocity = (Transforms[Next].GetTranslation() - Transforms[Previous].GetTranslation()) * 0.01 / DeltaTime;
+
+				// Rotation from the previous to the next sample, expressed in the body frame
+				FQuat DeltaRotation = Transforms[Previous].GetRotation().Inverse() * Transforms[Next].GetRotation();
+				if (DeltaRotation.W < 0.0)
+				{
+					DeltaRotation = -DeltaRotation;
+				}
+				FVector Axis;
+				double Angle;
+				DeltaRotation.ToAxisAndAngle(Axis, Angle);
+				AngularVelocity = Axis * Angle / DeltaTime;
 			}
-			Interrogator.Update();
 
-			// Get the camera pose transform for the frame
-			// Engine crashes in case multiple interrogations are added at once
-			TArray<FTransform> TempTransforms;
-			Interrogator.QueryWorldSpaceTransforms(UE::MovieScene::FInterrogationChannel::Default(), TempTransforms);
-			if (TempTransforms.Num() == 0)
+			FVector Acceleration = FVector::ZeroVector;
+			if (NumTransforms >= 3)
 			{
-				UE_LOG(LogEasySynth, Error, TEXT("%s: No camera transforms found"), *FString(__FUNCTION__))
-				return false;
+				const int32 Center = FMath::Clamp(Current, 1, NumTransforms - 2);
+				Acceleration = (Transforms[Center + 1].GetTranslation() - 2.0 * Transforms[Center].GetTranslation() +
+					Transforms[Center - 1].GetTranslation()) * 0.01 / FMath::Square(SampleTime);
 			}
 
-			for (FTransform& Transform : TempTransforms)
+			// Noise is seeded by the sample index inside the sequence, so that exports of different frame ranges,
+			// e.g. shards of the same rendering, get independent noise while a sample always gets the same one
+			FRandomStream NoiseStream(ImuNoiseSeed ^ static_cast<int32>(MurmurFinalize64(SectionFirstSequenceSample + Sample)));
+
+			// The IMU measures the angular velocity and the specific force inside the body frame
+			const FTransform& Transform = Transforms[Current];
+			const FVector Gyro = AngularVelocity + FVector(
+				GaussianNoise(NoiseStream, GyroNoise),
+				GaussianNoise(NoiseStream, GyroNoise),
+				GaussianNoise(NoiseStream, GyroNoise));
+			const FVector Accel = Transform.GetRotation().UnrotateVector(Acceleration + UpForce) + FVector(
+				GaussianNoise(NoiseStream, AccelNoise),
+				GaussianNoise(NoiseStream, AccelNoise),
+				GaussianNoise(NoiseStream, AccelNoise));
+
+			const FVector Translation = Transform.GetTranslation();
+			const FQuat Rotation = Transform.GetRotation();
+			WriteLine(FString::Printf(TEXT("%.6f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f"),
+				SectionStartTime + Sample * SampleTime,
+				Translation.X, Translation.Y, Translation.Z,
+				Rotation.X, Rotation.Y, Rotation.Z, Rotation.W,
+				Velocity.X, Velocity.Y, Velocity.Z,
+				AngularVelocity.X, AngularVelocity.Y, AngularVelocity.Z,
+				Acceleration.X, Acceleration.Y, Acceleration.Z,
+				Gyro.X, Gyro.Y, Gyro.Z,
+				Accel.X, Accel.Y, Accel.Z));
+		}
+
+		SectionStartTime += SectionTime;
+		SectionFirstSequenceSample += NumSectionSamples;
+	}
+
+	if (!FileWriter->Close())
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving the file %s"), *FString(__FUNCTION__), *FilePath)
+		return false;
+	}
+
+	return true;
+}
+
+FTransform FCameraPoseExporter::InterpolateTransform(const TArray<FTransform>& Transforms, const double Position)
+{
+	const int32 LastIndex = Transforms.Num() - 1;
+	const int32 Index = FMath::Clamp(FMath::FloorToInt32(Position), 0, LastIndex);
+	const double Alpha = FMath::Clamp(Position - Index, 0.0, 1.0);
+	const FTransform& Before = Transforms[FMath::Max(Index - 1, 0)];
+	const FTransform& Start = Transforms[Index];
+	const FTransform& End = Transforms[FMath::Min(Index + 1, LastIndex)];
+	const FTransform& After = Transforms[FMath::Min(Index + 2, LastIndex)];
+
+	// Uniform Catmull-Rom spline, so that velocities stay continuous across frames
+	const FVector P0 = Before.GetTranslation();
+	const FVector P1 = Start.GetTranslation();
+	const FVector P2 = End.GetTranslation();
+	const FVector P3 = After.GetTranslation();
+	const FVector Translation = 0.5 * (2.0 * P1 + (P2 - P0) * Alpha +
+		(2.0 * P0 - 5.0 * P1 + 4.0 * P2 - P3) * FMath::Square(Alpha) +
+		(3.0 * P1 - P0 - 3.0 * P2 + P3) * FMath::Cube(Alpha));
+
+	// Spherical spline through the same rotations, kept inside the hemisphere of the interpolated segment
+	FQuat Q0 = Before.GetRotation();
+	const FQuat Q1 = Start.GetRotation();
+	FQuat Q2 = End.GetRotation();
+	FQuat Q3 = After.GetRotation();
+	Q0.EnforceShortestArcWith(Q1);
+	Q2.EnforceShortestArcWith(Q1);
+	Q3.EnforceShortestArcWith(Q2);
+	const float Tension = 0.0f;
+	FQuat StartTangent;
+	FQuat EndTangent;
+	FQuat::CalcTangents(Q0, Q1, Q2, Tension, StartTangent);
+	FQuat::CalcTangents(Q1, Q2, Q3, Tension, EndTangent);
+	const FQuat Rotation = FQuat::Squad(Q1, StartTangent, Q2, EndTangent, Alpha).GetNormalized();
+
+	return FTransform(Rotation, Translation);
+}
+
+double FCameraPoseExporter::GaussianNoise(FRandomStream& RandomStream, const double StandardDeviation)
+{
+	if (StandardDeviation <= 0.0)
+	{
+		return 0.0;
+	}
+
+	// Box-Muller transform of two uniform samples, the first one kept away from zero
+	const double Uniform1 = FMath::Max(double(RandomStream.GetFraction()), UE_DOUBLE_SMALL_NUMBER);
+	const double Uniform2 = RandomStream.GetFraction();
+	return StandardDeviation * FMath::Sqrt(-2.0 * FMath::Loge(Uniform1)) * FMath::Cos(UE_DOUBLE_TWO_PI * Uniform2);
+}
+
+UMovieScene3DTransformTrack* FCameraPoseExporter::FindCameraTransformTrack(UMovieSceneCameraCutSection* CutSection)
+{
+	// Get the current cut section camera binding id
+	const FMovieSceneObjectBindingID& CameraBindingID = CutSection->GetCameraBindingID();
+
+	UMovieScene3DTransformTrack* CameraTransformTrack = nullptr;
+	for (const FMovieSceneBinding& Binding : SequencerWrapper.GetMovieScene()->GetBindings())
+	{
+		if (Binding.GetObjectGuid() == CameraBindingID.GetGuid())
+		{
+			for (UMovieSceneTrack* Track : Binding.GetTracks())
 			{
-				if (bAccumulateCameraOffset)
+				CameraTransformTrack = Cast<UMovieScene3DTransformTrack>(Track);
+				if (CameraTransformTrack != nullptr)
 				{
-					Transform.Accumulate(Camera->GetRelativeTransform());
+					break;
 				}
-
-				AccumulatedFrameTime += FrameTime;
-				Timestamps.Add(AccumulatedFrameTime);
 			}
+		}
+	}
+	return CameraTransformTrack;
+}
+
+bool FCameraPoseExporter::EvaluateTransformsPerFrame(
+	UMovieScene3DTransformTrack* TransformTrack,
+	const TConstArrayView<FFrameTime> TickNumbers,
+	TArray<FTransform>& OutTransforms)
+{
+	// Interrogator object that queries the transformation track for camera poses
+	UE::MovieScene::FSystemInterrogator Interrogator;
+
+	for (const FFrameTime& TickNumber : TickNumbers)
+	{
+		// Reinitialize the interrogator for each frame
+		Interrogator.Reset();
+		TGuardValue<UE::MovieScene::FEntityManager*> DebugVizGuard(
+			UE::MovieScene::GEntityManagerForDebuggingVisualizers, &Interrogator.GetLinker()->EntityManager);
+		Interrogator.ImportTrack(TransformTrack, UE::MovieScene::FInterrogationChannel::Default());
+
+		// Add frame interrogation
+		if (Interrogator.AddInterrogation(TickNumber) == INDEX_NONE)
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Adding interrogation failed"), *FString(__FUNCTION__))
+			return false;
+		}
+		Interrogator.Update();
 
-			CameraTransforms.Append(TempTransforms);
+		// Get the camera pose transform for the frame
+		TArray<FTransform> TempTransforms;
+		Interrogator.QueryWorldSpaceTransforms(UE::MovieScene::FInterrogationChannel::Default(), TempTransforms);
+		if (TempTransforms.Num() != 1)
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Expected a single camera transform, found %d"),
+				*FString(__FUNCTION__), TempTransforms.Num())
+			return false;
 		}
+		OutTransforms.Append(TempTransforms);
 	}
 
 	return true;
 }
 
-bool FCameraPoseExporter::SavePosesToCSV(const FString& FilePath)
+bool FCameraPoseExporter::BenchmarkPoseEvaluation(ULevelSequence* LevelSequence)
+{
+	if (FSequenceFrameEvaluator::InterrogationBatchSize() == 1)
+	{
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: The interrogation batch size is 1, so the batched evaluation matches the per frame one"),
+			*FString(__FUNCTION__))
+		return false;
+	}
+
+	// Both evaluation paths extract poses of the whole sequence
+	FCameraPoseExporter Exporters[2];
+	double ExtractionSeconds[2];
+	for (int32 i = 0; i < 2; i++)
+	{
+		FCameraPoseExporter& Exporter = Exporters[i];
+		Exporter.SetBatchedEvaluation(i == 0);
+		if (!Exporter.SequencerWrapper.OpenSequence(LevelSequence))
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Sequencer wrapper opening failed"), *FString(__FUNCTION__))
+			return false;
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		if (!Exporter.ExtractCameraTransforms())
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Camera pose extraction failed"), *FString(__FUNCTION__))
+			return false;
+		}
+		ExtractionSeconds[i] = FPlatformTime::Seconds() - StartTime;
+	}
+
+	// Poses have to match exactly, not only within a tolerance
+	const TArray<FTransform>& BatchedTransforms = Exporters[0].CameraTransforms;
+	const TArray<FTransform>& PerFrameTransforms = Exporters[1].CameraTransforms;
+	int32 NumMismatches = FMath::Abs(BatchedTransforms.Num() - PerFrameTransforms.Num());
+	for (int32 i = 0; i < FMath::Min(BatchedTransforms.Num(), PerFrameTransforms.Num()); i++)
+	{
+		if (BatchedTransforms[i].GetTranslation() != PerFrameTransforms[i].GetTranslation() ||
+			BatchedTransforms[i].GetRotation() != PerFrameTransforms[i].GetRotation() ||
+			BatchedTransforms[i].GetScale3D() != PerFrameTransforms[i].GetScale3D())
+		{
+			NumMismatches++;
+		}
+	}
+
+	UE_LOG(LogEasySynth, Log, TEXT("%s: %s - %d poses, batched by %d %.3f s, per frame %.3f s, %d mismatches"),
+		*FString(__FUNCTION__), *LevelSequence->GetName(), PerFrameTransforms.Num(),
+		FSequenceFrameEvaluator::InterrogationBatchSize(),
+		ExtractionSeconds[0], ExtractionSeconds[1], NumMismatches)
+	return NumMismatches == 0;
+}
+
+bool FCameraPoseExporter::SavePosesToCSV(const FString& FilePath, const TArray<FTransform>& Transforms) const
 {
 	// Create the file content
 	TArray<FString> Lines;
 	Lines.Add("id,tx,ty,tz,qx,qy,qz,qw,t");
 
-	for (int i = 0; i < CameraTransforms.Num(); i++)
+	for (int i = 0; i < Transforms.Num(); i++)
 	{
-		// Remove the scaling that makes no impact on camera functionality,
-		// but my be used to scale the camera placeholder mesh as user desires
-		CameraTransforms[i].SetScale3D(FVector(1.0f, 1.0f, 1.0f));
-		const FVector Translation = CameraTransforms[i].GetTranslation();
-		const FQuat Rotation = CameraTransforms[i].GetRotation();
+		// Scaling makes no impact on camera functionality, but my be used to scale
+		// the camera placeholder mesh as user desires, so only translation and rotation are saved
+		const FVector Translation = Transforms[i].GetTranslation();
+		const FQuat Rotation = Transforms[i].GetRotation();
 
 		Lines.Add(FString::Printf(TEXT("%d,%f,%f,%f,%f,%f,%f,%f,%f"),
 			i,
@@ -12,7 +12,7 @@
 bool FColorImageTarget::PrepareSequence(ULevelSequence* LevelSequence)
 {
 	// Update texture style inside the level
-	TextureStyleManager->CheckoutTextureStyle(ETextureStyle::COLOR);
+	TextureStyleManager->CheckoutTextureStyle(TextureStyle());
 
 	// Get all camera components bound to the level sequence
 	TArray<UCameraComponent*> Cameras = GetCameras(LevelSequence);
@@ -23,7 +23,7 @@ bool FColorImageTarget::PrepareSequence(ULevelSequence* LevelSequence)
 	}
 
 	// Prepare the camera post process material
-	UMaterial* PostProcessMaterial = LoadPostProcessMaterial();
+	UMaterialInterface* PostProcessMaterial = CreatePostProcessMaterial();
 	if (PostProcessMaterial == nullptr)
 	{
 		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not load color post process material"), *FString(__FUNCTION__))
@@ -49,3 +49,8 @@ bool FColorImageTarget::FinalizeSequence(ULevelSequence* LevelSequence)
 {
 	return ClearCameraPostProcess(LevelSequence);
 }
+
+UMaterialInterface* FColorImageTarget::CreatePostProcessMaterial()
+{
+	return LoadPostProcessMaterial();
+}
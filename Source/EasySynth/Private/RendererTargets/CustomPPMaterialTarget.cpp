@@ -12,7 +12,7 @@
 bool FCustomPPMaterialTarget::PrepareSequence(ULevelSequence* LevelSequence)
 {
 	// Update texture style inside the level
-	TextureStyleManager->CheckoutTextureStyle(ETextureStyle::COLOR);
+	TextureStyleManager->CheckoutTextureStyle(TextureStyle());
 
 	// Make sure the custom post process material is not null
 	if (CustomPPMaterial == nullptr)
@@ -48,3 +48,8 @@ bool FCustomPPMaterialTarget::FinalizeSequence(ULevelSequence* LevelSequence)
 {
 	return ClearCameraPostProcess(LevelSequence);
 }
+
+UMaterialInterface* FCustomPPMaterialTarget::CreatePostProcessMaterial()
+{
+	return CustomPPMaterial;
+}
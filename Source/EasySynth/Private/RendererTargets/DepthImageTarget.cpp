@@ -11,11 +11,19 @@
 
 
 const FString FDepthImageTarget::DepthRangeMetersParameter("DepthRangeMeters");
+const FString FDepthImageTarget::WorldDepthMaterialPath(
+	"/MovieRenderPipeline/Materials/MovieRenderQueue_WorldDepth.MovieRenderQueue_WorldDepth");
 
 bool FDepthImageTarget::PrepareSequence(ULevelSequence* LevelSequence)
 {
 	// Update texture style inside the level
-	TextureStyleManager->CheckoutTextureStyle(ETextureStyle::COLOR);
+	TextureStyleManager->CheckoutTextureStyle(TextureStyle());
+
+	// Depth in meters is output by its own render pass, so cameras must not apply any post process
+	if (bDepthInMeters)
+	{
+		return ClearCameraPostProcess(LevelSequence);
+	}
 
 	// Get all camera components bound to the level sequence
 	TArray<UCameraComponent*> Cameras = GetCameras(LevelSequence);
@@ -26,22 +34,12 @@ bool FDepthImageTarget::PrepareSequence(ULevelSequence* LevelSequence)
 	}
 
 	// Prepare the camera post process material
-	UMaterial* PostProcessMaterial = LoadPostProcessMaterial();
-	if (PostProcessMaterial == nullptr)
-	{
-		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not load depth post process material"), *FString(__FUNCTION__))
-		return false;
-	}
-
-	// Create the material instance and set the range parameter
-	UMaterialInstanceDynamic* PostProcessMaterialInstance =
-		UMaterialInstanceDynamic::Create(PostProcessMaterial, nullptr);
+	UMaterialInterface* PostProcessMaterialInstance = CreatePostProcessMaterial();
 	if (PostProcessMaterialInstance == nullptr)
 	{
-		UE_LOG(LogTemp, Error, TEXT("%s: Could not create the material instance dynamic"), *FString(__FUNCTION__))
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not create depth post process material"), *FString(__FUNCTION__))
 		return false;
 	}
-	PostProcessMaterialInstance->SetScalarParameterValue(*DepthRangeMetersParameter, DepthRangeMeters);
 
 	for (UCameraComponent* Camera : Cameras)
 	{
@@ -61,3 +59,57 @@ bool FDepthImageTarget::FinalizeSequence(ULevelSequence* LevelSequence)
 {
 	return ClearCameraPostProcess(LevelSequence);
 }
+
+TArray<UMaterialInterface*> FDepthImageTarget::RenderPassMaterials() const
+{
+	if (!bDepthInMeters)
+	{
+		return TArray<UMaterialInterface*>();
+	}
+
+	UMaterialInterface* WorldDepthMaterial = LoadWorldDepthMaterial();
+	if (WorldDepthMaterial == nullptr)
+	{
+		return TArray<UMaterialInterface*>();
+	}
+	return TArray<UMaterialInterface*>({ WorldDepthMaterial });
+}
+
+UMaterialInterface* FDepthImageTarget::CreatePostProcessMaterial()
+{
+	if (bDepthInMeters)
+	{
+		return LoadWorldDepthMaterial();
+	}
+
+	// Prepare the post process material
+	UMaterial* PostProcessMaterial = LoadPostProcessMaterial();
+	if (PostProcessMaterial == nullptr)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not load depth post process material"), *FString(__FUNCTION__))
+		return nullptr;
+	}
+
+	// Create the material instance and set the range parameter
+	UMaterialInstanceDynamic* PostProcessMaterialInstance =
+		UMaterialInstanceDynamic::Create(PostProcessMaterial, nullptr);
+	if (PostProcessMaterialInstance == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s: Could not create the material instance dynamic"), *FString(__FUNCTION__))
+		return nullptr;
+	}
+	PostProcessMaterialInstance->SetScalarParameterValue(*DepthRangeMetersParameter, DepthRangeMeters);
+
+	return PostProcessMaterialInstance;
+}
+
+UMaterialInterface* FDepthImageTarget::LoadWorldDepthMaterial()
+{
+	UMaterialInterface* WorldDepthMaterial = LoadObject<UMaterialInterface>(nullptr, *WorldDepthMaterialPath);
+	if (WorldDepthMaterial == nullptr)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not load the world depth material %s"),
+			*FString(__FUNCTION__), *WorldDepthMaterialPath)
+	}
+	return WorldDepthMaterial;
+}
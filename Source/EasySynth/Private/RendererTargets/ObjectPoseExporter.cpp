@@ -0,0 +1,183 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "RendererTargets/ObjectPoseExporter.h"
+
+#include "ISequencer.h"
+#include "Misc/FileHelper.h"
+#include "MovieScene.h"
+#include "Tracks/MovieScene3DTransformTrack.h"
+
+#include "EasySynth.h"
+#include "NpyFile.h"
+#include "PathUtils.h"
+#include "TextureStyles/TextureStyleManager.h"
+
+
+const FString FObjectPoseExporter::ObjectsFileName(TEXT("Objects.csv"));
+const FString FObjectPoseExporter::FrameColumnFileName(TEXT("frame.npy"));
+const FString FObjectPoseExporter::TimestampColumnFileName(TEXT("t.npy"));
+const FString FObjectPoseExporter::TranslationColumnFileName(TEXT("translation.npy"));
+const FString FObjectPoseExporter::RotationColumnFileName(TEXT("rotation.npy"));
+
+bool FObjectPoseExporter::ExportObjectPoses(
+	ULevelSequence* LevelSequence,
+	const FString& OutputDir,
+	const UTextureStyleManager* TextureStyleManager)
+{
+	// Open the received level sequence inside the sequencer wrapper
+	if (!SequencerWrapper.OpenSequence(LevelSequence))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Sequencer wrapper opening failed"), *FString(__FUNCTION__))
+		return false;
+	}
+
+	if (!FindPosedObjects(TextureStyleManager))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not find posed objects"), *FString(__FUNCTION__))
+		return false;
+	}
+	FSequenceFrameEvaluator::CollectFrameTicks(SequencerWrapper, FrameRange, Frames);
+
+	const FString ObjectPosesDir = FPathUtils::ObjectPosesDir(OutputDir);
+	if (!SaveObjectsToCSV(ObjectPosesDir / ObjectsFileName, PosedObjects))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving posed objects to the file"), *FString(__FUNCTION__))
+		return false;
+	}
+
+	// Frame numbers and timestamps are written at once, while poses are appended batch by batch
+	const int64 NumFrames = Frames.TickNumbers.Num();
+	const int64 NumObjects = PosedObjects.Num();
+	TUniquePtr<FArchive> FrameWriter =
+		FNpyFile::CreateWriter(ObjectPosesDir / FrameColumnFileName, TEXT("'<i4'"), { NumFrames });
+	TUniquePtr<FArchive> TimestampWriter =
+		FNpyFile::CreateWriter(ObjectPosesDir / TimestampColumnFileName, TEXT("'<f8'"), { NumFrames });
+	TUniquePtr<FArchive> TranslationWriter =
+		FNpyFile::CreateWriter(ObjectPosesDir / TranslationColumnFileName, TEXT("'<f8'"), { NumFrames, NumObjects, 3 });
+	TUniquePtr<FArchive> RotationWriter =
+		FNpyFile::CreateWriter(ObjectPosesDir / RotationColumnFileName, TEXT("'<f4'"), { NumFrames, NumObjects, 4 });
+	if (!FrameWriter.IsValid() || !TimestampWriter.IsValid() || !TranslationWriter.IsValid() || !RotationWriter.IsValid())
+	{
+		return false;
+	}
+
+	FrameWriter->Serialize(Frames.FrameNumbers.GetData(), Frames.FrameNumbers.Num() * sizeof(int32));
+	TimestampWriter->Serialize(Frames.Timestamps.GetData(), Frames.Timestamps.Num() * sizeof(double));
+	if (!EvaluateAndSaveTransforms(*TranslationWriter, *RotationWriter))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Object pose evaluation failed"), *FString(__FUNCTION__))
+		return false;
+	}
+
+	if (!FrameWriter->Close() || !TimestampWriter->Close() || !TranslationWriter->Close() || !RotationWriter->Close())
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving object pose columns to %s"),
+			*FString(__FUNCTION__), *ObjectPosesDir)
+		return false;
+	}
+
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Exported poses of %lld objects for %lld frames"),
+		*FString(__FUNCTION__), NumObjects, NumFrames)
+	return true;
+}
+
+bool FObjectPoseExporter::FindPosedObjects(const UTextureStyleManager* TextureStyleManager)
+{
+	ISequencer* Sequencer = SequencerWrapper.GetSequencer();
+	for (const FMovieSceneBinding& Binding : SequencerWrapper.GetMovieScene()->GetBindings())
+	{
+		UMovieScene3DTransformTrack* TransformTrack = nullptr;
+		for (UMovieSceneTrack* Track : Binding.GetTracks())
+		{
+			TransformTrack = Cast<UMovieScene3DTransformTrack>(Track);
+			if (TransformTrack != nullptr)
+			{
+				break;
+			}
+		}
+		if (TransformTrack == nullptr)
+		{
+			continue;
+		}
+
+		FObjectDescription& PosedObject = PosedObjects.AddDefaulted_GetRef();
+		PosedObject.Name = Binding.GetName();
+		TransformTracks.Add(TransformTrack);
+
+		// Component bindings are described by the actor owning the component,
+		// while spawnables that are not spawned at the moment keep a zero actor GUID
+		for (const TWeakObjectPtr<>& BoundObject :
+			Sequencer->FindBoundObjects(Binding.GetObjectGuid(), Sequencer->GetFocusedTemplateID()))
+		{
+			AActor* Actor = Cast<AActor>(BoundObject.Get());
+			if (Actor == nullptr && Cast<UActorComponent>(BoundObject.Get()) != nullptr)
+			{
+				Actor = Cast<UActorComponent>(BoundObject.Get())->GetOwner();
+			}
+			if (Actor != nullptr)
+			{
+				PosedObject.ActorGuid = Actor->GetActorGuid();
+				PosedObject.ClassName = TextureStyleManager->ActorClassName(PosedObject.ActorGuid);
+				break;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool FObjectPoseExporter::EvaluateAndSaveTransforms(FArchive& TranslationWriter, FArchive& RotationWriter)
+{
+	const int32 NumObjects = PosedObjects.Num();
+	return FSequenceFrameEvaluator::EvaluateTransformTracks(TransformTracks, Frames.TickNumbers,
+		[NumObjects, &TranslationWriter, &RotationWriter](const int32 BatchStartIndex, const TArray<TArray<FTransform>>& ObjectTransforms)
+		{
+			// Columns are ordered by frames first, so that each batch is a contiguous block of both files
+			const int32 NumBatchTicks = ObjectTransforms[0].Num();
+			TArray64<double> Translations;
+			Translations.SetNumUninitialized(int64(NumBatchTicks) * NumObjects * 3);
+			TArray64<float> Rotations;
+			Rotations.SetNumUninitialized(int64(NumBatchTicks) * NumObjects * 4);
+			for (int32 i = 0; i < NumBatchTicks; i++)
+			{
+				for (int32 ObjectId = 0; ObjectId < NumObjects; ObjectId++)
+				{
+					const int64 PoseIndex = int64(i) * NumObjects + ObjectId;
+					const FVector Translation = ObjectTransforms[ObjectId][i].GetTranslation();
+					const FQuat Rotation = ObjectTransforms[ObjectId][i].GetRotation();
+					Translations[PoseIndex * 3 + 0] = Translation.X;
+					Translations[PoseIndex * 3 + 1] = Translation.Y;
+					Translations[PoseIndex * 3 + 2] = Translation.Z;
+					Rotations[PoseIndex * 4 + 0] = Rotation.X;
+					Rotations[PoseIndex * 4 + 1] = Rotation.Y;
+					Rotations[PoseIndex * 4 + 2] = Rotation.Z;
+					Rotations[PoseIndex * 4 + 3] = Rotation.W;
+				}
+			}
+			TranslationWriter.Serialize(Translations.GetData(), Translations.Num() * sizeof(double));
+			RotationWriter.Serialize(Rotations.GetData(), Rotations.Num() * sizeof(float));
+			return true;
+		});
+}
+
+bool FObjectPoseExporter::SaveObjectsToCSV(const FString& FilePath, const TArray<FObjectDescription>& Objects)
+{
+	TArray<FString> Lines;
+	Lines.Add("id,actor_guid,name,class");
+	for (int i = 0; i < Objects.Num(); i++)
+	{
+		Lines.Add(FString::Printf(TEXT("%d,%s,%s,%s"),
+			i,
+			*Objects[i].ActorGuid.ToString(EGuidFormats::DigitsWithHyphens),
+			*Objects[i].Name,
+			*Objects[i].ClassName));
+	}
+
+	if (!FFileHelper::SaveStringArrayToFile(Lines, *FilePath))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving the file %s"), *FString(__FUNCTION__), *FilePath)
+		return false;
+	}
+
+	return true;
+}
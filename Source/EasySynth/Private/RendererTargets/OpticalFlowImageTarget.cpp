@@ -4,6 +4,10 @@
 
 #include "Camera/CameraComponent.h"
 #include "LevelSequence.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialExpressionCustom.h"
+#include "Materials/MaterialExpressionSceneTexture.h"
+#include "Materials/MaterialExpressionScreenPosition.h"
 #include "Materials/MaterialInstanceDynamic.h"
 
 #include "EasySynth.h"
@@ -12,10 +16,29 @@
 
 const FString FOpticalFlowImageTarget::OpticalFlowScaleParameter("OpticalFlowScale");
 
+// Reprojects the pixel into the previous frame the same way the color-coded material does,
+// assuming a static scene, and returns the vector from the previous to the current position
+const FString FOpticalFlowImageTarget::FlowValuesMaterialCode(TEXT(
+	"float2 ScreenPos = ViewportUVToScreenPos(UV);\n"
+	"float4 PrevClip = mul(float4(ScreenPos, ConvertToDeviceZ(Depth), 1.0f), View.ClipToPrevClip);\n"
+	"return float3((ScreenPos - PrevClip.xy / PrevClip.w) * float2(0.5f, -0.5f), 0.0f);"));
+
 bool FOpticalFlowImageTarget::PrepareSequence(ULevelSequence* LevelSequence)
 {
 	// Update texture style inside the level
-	TextureStyleManager->CheckoutTextureStyle(ETextureStyle::COLOR);
+	TextureStyleManager->CheckoutTextureStyle(TextureStyle());
+
+	// Optical flow in pixels is output by its own render pass, so cameras must not apply any post process
+	if (bOpticalFlowInPixels)
+	{
+		PassMaterial = CreateFlowValuesMaterial();
+		if (PassMaterial == nullptr)
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Could not create optical flow post process material"), *FString(__FUNCTION__))
+			return false;
+		}
+		return ClearCameraPostProcess(LevelSequence);
+	}
 
 	// Get all camera components bound to the level sequence
 	TArray<UCameraComponent*> Cameras = GetCameras(LevelSequence);
@@ -26,22 +49,12 @@ bool FOpticalFlowImageTarget::PrepareSequence(ULevelSequence* LevelSequence)
 	}
 
 	// Prepare the camera post process material
-	UMaterial* PostProcessMaterial = LoadPostProcessMaterial();
-	if (PostProcessMaterial == nullptr)
-	{
-		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not load optical flow post process material"), *FString(__FUNCTION__))
-		return false;
-	}
-
-	// Create the material instance and set the scale parameter
-	UMaterialInstanceDynamic* PostProcessMaterialInstance =
-		UMaterialInstanceDynamic::Create(PostProcessMaterial, nullptr);
+	UMaterialInterface* PostProcessMaterialInstance = CreatePostProcessMaterial();
 	if (PostProcessMaterialInstance == nullptr)
 	{
-		UE_LOG(LogTemp, Error, TEXT("%s: Could not create the material instance dynamic"), *FString(__FUNCTION__))
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not create optical flow post process material"), *FString(__FUNCTION__))
 		return false;
 	}
-	PostProcessMaterialInstance->SetScalarParameterValue(*OpticalFlowScaleParameter, OpticalFlowScale);
 
 	for (UCameraComponent* Camera : Cameras)
 	{
@@ -59,5 +72,73 @@ bool FOpticalFlowImageTarget::PrepareSequence(ULevelSequence* LevelSequence)
 
 bool FOpticalFlowImageTarget::FinalizeSequence(ULevelSequence* LevelSequence)
 {
+	PassMaterial = nullptr;
 	return ClearCameraPostProcess(LevelSequence);
 }
+
+TArray<UMaterialInterface*> FOpticalFlowImageTarget::RenderPassMaterials() const
+{
+	if (!bOpticalFlowInPixels || PassMaterial == nullptr)
+	{
+		return TArray<UMaterialInterface*>();
+	}
+	return TArray<UMaterialInterface*>({ PassMaterial });
+}
+
+void FOpticalFlowImageTarget::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(PassMaterial);
+}
+
+UMaterialInterface* FOpticalFlowImageTarget::CreatePostProcessMaterial()
+{
+	// Prepare the post process material
+	UMaterial* PostProcessMaterial = LoadPostProcessMaterial();
+	if (PostProcessMaterial == nullptr)
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not load optical flow post process material"), *FString(__FUNCTION__))
+		return nullptr;
+	}
+
+	// Create the material instance and set the scale parameter
+	UMaterialInstanceDynamic* PostProcessMaterialInstance =
+		UMaterialInstanceDynamic::Create(PostProcessMaterial, nullptr);
+	if (PostProcessMaterialInstance == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s: Could not create the material instance dynamic"), *FString(__FUNCTION__))
+		return nullptr;
+	}
+	PostProcessMaterialInstance->SetScalarParameterValue(*OpticalFlowScaleParameter, OpticalFlowScale);
+
+	return PostProcessMaterialInstance;
+}
+
+UMaterialInterface* FOpticalFlowImageTarget::CreateFlowValuesMaterial()
+{
+	// Flow values are written as they are computed, instead of being decoded from the lossy HSV colors
+	UMaterial* Material = NewObject<UMaterial>(GetTransientPackage(), NAME_None, RF_Transient);
+	Material->MaterialDomain = EMaterialDomain::MD_PostProcess;
+
+	UMaterialExpressionScreenPosition* ScreenPosition = NewObject<UMaterialExpressionScreenPosition>(Material);
+	UMaterialExpressionSceneTexture* SceneDepth = NewObject<UMaterialExpressionSceneTexture>(Material);
+	SceneDepth->SceneTextureId = ESceneTextureId::PPI_SceneDepth;
+
+	UMaterialExpressionCustom* FlowValues = NewObject<UMaterialExpressionCustom>(Material);
+	FlowValues->OutputType = ECustomMaterialOutputType::CMOT_Float3;
+	FlowValues->Code = FlowValuesMaterialCode;
+	FlowValues->Inputs.SetNum(2);
+	FlowValues->Inputs[0].InputName = TEXT("UV");
+	FlowValues->Inputs[0].Input.Connect(0, ScreenPosition);
+	FlowValues->Inputs[1].InputName = TEXT("Depth");
+	FlowValues->Inputs[1].Input.Connect(0, SceneDepth);
+	FlowValues->Inputs[1].Input.SetMask(1, 1, 0, 0, 0);
+
+	Material->GetExpressionCollection().AddExpression(ScreenPosition);
+	Material->GetExpressionCollection().AddExpression(SceneDepth);
+	Material->GetExpressionCollection().AddExpression(FlowValues);
+	Material->GetEditorOnlyData()->EmissiveColor.Connect(0, FlowValues);
+
+	// Compiles the material shaders, which the renderer waits for before rendering
+	Material->PostEditChange();
+	return Material;
+}
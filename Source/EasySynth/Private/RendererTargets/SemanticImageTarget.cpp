@@ -6,13 +6,14 @@
 #include "LevelSequence.h"
 
 #include "EasySynth.h"
+#include "TextureStyles/TextureMappingAsset.h"
 #include "TextureStyles/TextureStyleManager.h"
 
 
 bool FSemanticImageTarget::PrepareSequence(ULevelSequence* LevelSequence)
 {
 	// Update texture style inside the level
-	TextureStyleManager->CheckoutTextureStyle(ETextureStyle::SEMANTIC);
+	TextureStyleManager->CheckoutTextureStyle(TextureStyle());
 
 	// Get all camera components bound to the level sequence
 	TArray<UCameraComponent*> Cameras = GetCameras(LevelSequence);
@@ -23,7 +24,7 @@ bool FSemanticImageTarget::PrepareSequence(ULevelSequence* LevelSequence)
 	}
 
 	// Prepare the camera post process material
-	UMaterial* PostProcessMaterial = LoadPostProcessMaterial();
+	UMaterialInterface* PostProcessMaterial = CreatePostProcessMaterial();
 	if (PostProcessMaterial == nullptr)
 	{
 		UE_LOG(LogEasySynth, Error, TEXT("%s: Could not load semantic post process material"), *FString(__FUNCTION__))
@@ -48,3 +49,21 @@ bool FSemanticImageTarget::FinalizeSequence(ULevelSequence* LevelSequence)
 {
 	return ClearCameraPostProcess(LevelSequence);
 }
+
+UMaterialInterface* FSemanticImageTarget::CreatePostProcessMaterial()
+{
+	return LoadPostProcessMaterial();
+}
+
+TArray<FColor> FSemanticImageTarget::ClassIndexColors() const
+{
+	TArray<FColor> ClassColors;
+	if (bClassIndices)
+	{
+		for (const FSemanticClass* SemanticClass : TextureStyleManager->SemanticClasses())
+		{
+			ClassColors.Add(SemanticClass->Color);
+		}
+	}
+	return ClassColors;
+}
@@ -0,0 +1,157 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "RendererTargets/SequenceFrameEvaluator.h"
+
+#include "EntitySystem/Interrogation/MovieSceneInterrogationLinker.h"
+#include "EntitySystem/MovieSceneEntitySystemTypes.h"
+#include "HAL/IConsoleManager.h"
+#include "MovieScene.h"
+#include "MovieScenePropertyBinding.h"
+#include "Sections/MovieSceneCameraCutSection.h"
+#include "Tracks/MovieScene3DTransformTrack.h"
+
+#include "EasySynth.h"
+#include "SequencerWrapper.h"
+
+
+static TAutoConsoleVariable<int32> CVarPoseInterrogationBatchSize(
+	TEXT("EasySynth.PoseInterrogationBatchSize"),
+	1,
+	TEXT("Maximum number of frames transform tracks are evaluated for by a single interrogator update.\n")
+	TEXT("Engine crashes in case multiple interrogations are added at once, as seen with earlier engine versions,\n")
+	TEXT("so frames are evaluated one by one unless a larger batch is verified using the -BenchmarkPoseExport switch."),
+	ECVF_Default);
+
+void FSequenceFrameEvaluator::CollectFrameTicks(
+	FSequencerWrapper& SequencerWrapper,
+	const TRange<int32>& FrameRange,
+	FFrames& OutFrames)
+{
+	// Get level sequence fps
+	const FFrameRate DisplayRate = SequencerWrapper.GetMovieScene()->GetDisplayRate();
+	const double FrameTime = 1.0f / DisplayRate.AsDecimal();
+	double AccumulatedFrameTime = 0.0f;
+
+	// Engine likes to update much more often than the video frame rate,
+	// so ticks per frame are needed to calculate engine ticks that correspond to frames
+	const FFrameRate TickResolutions = SequencerWrapper.GetMovieScene()->GetTickResolution();
+	const int TicksPerFrame = TickResolutions.AsDecimal() / DisplayRate.AsDecimal();
+
+	for (UMovieSceneCameraCutSection* CutSection : SequencerWrapper.GetMovieSceneCutSections())
+	{
+		// Inclusive lower and exclusive upper bound of the movie scene ticks that belong to this cut section
+		const FFrameNumber StartTickNumber = CutSection->GetTrueRange().GetLowerBoundValue();
+		const FFrameNumber EndTickNumber = CutSection->GetTrueRange().GetUpperBoundValue();
+		int32 NumSectionFrames = 0;
+		for (FFrameNumber TickNumber = StartTickNumber; TickNumber < EndTickNumber; TickNumber += TicksPerFrame)
+		{
+			// Skip frames outside of the requested range, while keeping the timestamps absolute
+			const int32 FrameNumber = FFrameRate::TransformTime(
+				FFrameTime(TickNumber), TickResolutions, DisplayRate).FloorToFrame().Value;
+			AccumulatedFrameTime += FrameTime;
+			if (!FrameRange.Contains(FrameNumber))
+			{
+				continue;
+			}
+
+			OutFrames.TickNumbers.Add(TickNumber);
+			OutFrames.FrameNumbers.Add(FrameNumber);
+			OutFrames.Timestamps.Add(AccumulatedFrameTime);
+			NumSectionFrames++;
+		}
+		OutFrames.SectionNumFrames.Add(NumSectionFrames);
+	}
+}
+
+bool FSequenceFrameEvaluator::EvaluateTransformTracks(
+	const TArray<UMovieScene3DTransformTrack*>& TransformTracks,
+	const TConstArrayView<FFrameTime> TickNumbers,
+	TFunctionRef<bool(const int32 BatchStartIndex, const TArray<TArray<FTransform>>& TrackTransforms)> BatchCallback)
+{
+	const int32 NumTracks = TransformTracks.Num();
+	if (NumTracks == 0)
+	{
+		return true;
+	}
+
+	const int32 MaxInterrogationsPerBatch = InterrogationBatchSize();
+
+	// Interrogator object that queries the transform tracks
+	UE::MovieScene::FSystemInterrogator Interrogator;
+
+	int32 NextTickIndex = 0;
+	while (NextTickIndex < TickNumbers.Num())
+	{
+		Interrogator.Reset();
+		TGuardValue<UE::MovieScene::FEntityManager*> DebugVizGuard(
+			UE::MovieScene::GEntityManagerForDebuggingVisualizers, &Interrogator.GetLinker()->EntityManager);
+
+		// Each track gets its own channel, so that a single update evaluates all tracks for all ticks of the batch
+		TArray<UE::MovieScene::FInterrogationChannel> Channels;
+		for (int32 TrackId = 0; TrackId < NumTracks; TrackId++)
+		{
+			const UE::MovieScene::FInterrogationChannel Channel = (TrackId == 0) ?
+				UE::MovieScene::FInterrogationChannel::Default() :
+				Interrogator.AllocateChannel(
+					UE::MovieScene::FInterrogationChannel::Invalid(), FMovieScenePropertyBinding(TEXT("Transform"), TEXT("Transform")));
+			Interrogator.ImportTrack(TransformTracks[TrackId], Channel);
+			Channels.Add(Channel);
+		}
+
+		const int32 BatchStartIndex = NextTickIndex;
+		while (NextTickIndex < TickNumbers.Num() && NextTickIndex - BatchStartIndex < MaxInterrogationsPerBatch)
+		{
+			if (Interrogator.AddInterrogation(TickNumbers[NextTickIndex]) == INDEX_NONE)
+			{
+				break;
+			}
+			NextTickIndex++;
+		}
+		if (NextTickIndex == BatchStartIndex)
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Adding interrogation failed"), *FString(__FUNCTION__))
+			return false;
+		}
+		Interrogator.Update();
+
+		// A single transform is returned for each interrogation, in the order they were added
+		const int32 NumBatchTicks = NextTickIndex - BatchStartIndex;
+		TArray<TArray<FTransform>> TrackTransforms;
+		TrackTransforms.SetNum(NumTracks);
+		for (int32 TrackId = 0; TrackId < NumTracks; TrackId++)
+		{
+			Interrogator.QueryWorldSpaceTransforms(Channels[TrackId], TrackTransforms[TrackId]);
+			if (TrackTransforms[TrackId].Num() != NumBatchTicks)
+			{
+				UE_LOG(LogEasySynth, Error, TEXT("%s: Expected %d transforms of the track %d, found %d"),
+					*FString(__FUNCTION__), NumBatchTicks, TrackId, TrackTransforms[TrackId].Num())
+				return false;
+			}
+		}
+
+		if (!BatchCallback(BatchStartIndex, TrackTransforms))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FSequenceFrameEvaluator::EvaluateTransformTrack(
+	UMovieScene3DTransformTrack* TransformTrack,
+	const TConstArrayView<FFrameTime> TickNumbers,
+	TArray<FTransform>& OutTransforms)
+{
+	return EvaluateTransformTracks({ TransformTrack }, TickNumbers,
+		[&OutTransforms](const int32 BatchStartIndex, const TArray<TArray<FTransform>>& TrackTransforms)
+		{
+			OutTransforms.Append(TrackTransforms[0]);
+			return true;
+		});
+}
+
+int32 FSequenceFrameEvaluator::InterrogationBatchSize()
+{
+	return FMath::Max(1, CVarPoseInterrogationBatchSize.GetValueOnAnyThread());
+}
@@ -0,0 +1,101 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#include "RendererTargets/SinglePassTarget.h"
+
+#include "LevelSequence.h"
+#include "Materials/MaterialInstanceDynamic.h"
+
+#include "EasySynth.h"
+#include "TextureStyles/TextureStyleManager.h"
+
+
+FString FSinglePassTarget::Name() const
+{
+	return FString::Join(TargetNames(), TEXT("+"));
+}
+
+TArray<FString> FSinglePassTarget::OutputNames() const
+{
+	if (bMultilayerExr)
+	{
+		return TArray<FString>({ Name() });
+	}
+	return TargetNames();
+}
+
+TArray<FString> FSinglePassTarget::TargetNames() const
+{
+	TArray<FString> TargetNames;
+	for (const TSharedPtr<FRendererTarget>& Target : Targets)
+	{
+		TargetNames.Add(Target->Name());
+	}
+	return TargetNames;
+}
+
+bool FSinglePassTarget::PrepareSequence(ULevelSequence* LevelSequence)
+{
+	// Update texture style inside the level
+	TextureStyleManager->CheckoutTextureStyle(TextureStyle());
+
+	// Targets are rendered as separate render passes, so cameras must not apply any of them
+	if (!ClearCameraPostProcess(LevelSequence))
+	{
+		return false;
+	}
+
+	// Prepare post process materials of all targets
+	PassMaterials.Empty();
+	for (const TSharedPtr<FRendererTarget>& Target : Targets)
+	{
+		UMaterialInterface* PostProcessMaterial = Target->CreatePostProcessMaterial();
+		if (PostProcessMaterial == nullptr)
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Could not create the %s post process material"),
+				*FString(__FUNCTION__), *Target->Name())
+			return false;
+		}
+
+		UMaterialInterface* PassMaterial = CreatePassMaterial(PostProcessMaterial, Target->Name());
+		if (PassMaterial == nullptr)
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Could not create the %s render pass material"),
+				*FString(__FUNCTION__), *Target->Name())
+			return false;
+		}
+		PassMaterials.Add(PassMaterial);
+	}
+
+	return true;
+}
+
+bool FSinglePassTarget::FinalizeSequence(ULevelSequence* LevelSequence)
+{
+	PassMaterials.Empty();
+	return ClearCameraPostProcess(LevelSequence);
+}
+
+bool FSinglePassTarget::AcceptsTarget(const TSharedPtr<FRendererTarget>& Target) const
+{
+	return Target->ImageFormat == ImageFormat && Target->TextureStyle() == PassTextureStyle;
+}
+
+void FSinglePassTarget::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObjects(PassMaterials);
+}
+
+UMaterialInterface* FSinglePassTarget::CreatePassMaterial(UMaterialInterface* Material, const FString& PassName)
+{
+	// The movie pipeline names post-process render passes after their materials,
+	// which is later used to route each pass into its target directory,
+	// so make sure a previously created material does not occupy the name
+	const FName PassMaterialName(*PassName);
+	UObject* ExistingObject = StaticFindObjectFast(nullptr, GetTransientPackage(), PassMaterialName);
+	if (ExistingObject != nullptr)
+	{
+		ExistingObject->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
+	}
+
+	return UMaterialInstanceDynamic::Create(Material, GetTransientPackage(), PassMaterialName);
+}
@@ -3,28 +3,67 @@
 #include "SequenceRenderer.h"
 
 #include "CineCameraComponent.h"
+#include "FileHelpers.h"
 #include "ISequencer.h"
+#include "JsonObjectConverter.h"
+#include "LevelSequence.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeExit.h"
+#include "MoviePipelineCameraSetting.h"
+#include "MoviePipelineDeferredPasses.h"
+#include "MoviePipelineExecutor.h"
 #include "MoviePipelineImageSequenceOutput.h"
 #include "MoviePipelineOutputSetting.h"
+#include "MoviePipelineQueue.h"
 #include "MoviePipelineQueueSubsystem.h"
 #include "MovieRenderPipelineSettings.h"
+#include "MovieScene.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
 #include "Sections/MovieSceneCameraCutSection.h"
 
+#include "CameraRig/CameraRigRosInterface.h"
+#include "ClassIndexOutput/MoviePipelineClassIndexOutput.h"
 #include "EasySynth.h"
 #include "EXROutput/MoviePipelineEXROutputLocal.h"
+#include "ImageOutput/MoviePipelineImageOutputLocal.h"
 #include "PathUtils.h"
+#include "RendererTargets/BoundingBoxExporter.h"
 #include "RendererTargets/CameraPoseExporter.h"
+#include "RendererTargets/ObjectPoseExporter.h"
 #include "RendererTargets/RendererTarget.h"
+#include "RendererTargets/SequenceFrameEvaluator.h"
+#include "RenderTelemetry.h"
+#include "SequencerWrapper.h"
 #include "TextureStyles/SemanticCsvInterface.h"
 
 
+TRACE_DECLARE_INT_COUNTER(EasySynthRenderJobsStarted, TEXT("EasySynth/RenderJobsStarted"));
+
 const float FRendererTargetOptions::DefaultDepthRangeMetersValue = 100.0f;
 const float FRendererTargetOptions::DefaultOpticalFlowScaleValue = 1.0f;
 
+const float USequenceRenderer::ProgressUpdateIntervalSeconds = 2.0f;
+const FName USequenceRenderer::EditorRendererName(TEXT("EasySynthSequenceRenderer"));
+
 FRendererTargetOptions::FRendererTargetOptions() :
 	bExportCameraPoses(false),
+	bExportObjectPoses(false),
+	bExportBoundingBoxes(false),
 	DepthRangeMetersValue(DefaultDepthRangeMetersValue),
-	OpticalFlowScaleValue(DefaultOpticalFlowScaleValue)
+	bDepthInMeters(false),
+	OpticalFlowScaleValue(DefaultOpticalFlowScaleValue),
+	bOpticalFlowInPixels(false),
+	bSemanticClassIndices(false),
+	bMultilayerExr(false),
+	DatasetShardSizeMegabytesValue(0),
+	ImuRateHzValue(0.0f),
+	ImuGyroNoiseValue(0.0f),
+	ImuAccelNoiseValue(0.0f),
+	bSinglePassRendering(false),
+	bParallelRigRendering(false),
+	bResumeRendering(false),
+	ReadinessTimeoutValue(FReadinessScheduler::DefaultTimeoutSeconds)
 {
 	SelectedTargets.Init(false, TargetType::COUNT);
 	OutputFormats.Init(EImageFormat::JPEG, TargetType::COUNT);
@@ -53,22 +92,59 @@ void FRendererTargetOptions::GetSelectedTargets(
 	TQueue<TSharedPtr<FRendererTarget>>& OutTargetsQueue) const
 {
 	OutTargetsQueue.Empty();
+
+	// Passes grouping targets that can be rendered together, used in the single pass mode
+	TArray<TSharedPtr<FSinglePassTarget>> SinglePasses;
+
+	// Each pipeline job starts its own PIE session and warm-up,
+	// so the rig rendering always combines compatible targets to render as few jobs as possible
+	const bool bCombineTargets = (bSinglePassRendering || bParallelRigRendering);
+
 	for (int i = 0; i < TargetType::COUNT; i++)
 	{
 		if (SelectedTargets[i])
 		{
 			TSharedPtr<FRendererTarget> Target = RendererTarget(i, TextureStyleManager);
-			if (Target != nullptr)
-			{
-				OutTargetsQueue.Enqueue(Target);
-			}
-			else
+			if (Target == nullptr)
 			{
 				UE_LOG(LogEasySynth, Error, TEXT("%s: Target selection mapped to null renderer target"),
 					*FString(__FUNCTION__))
 				OutTargetsQueue.Empty();
 				return;
 			}
+
+			// Raw and class index outputs need their own files, so they are not combined with other targets
+			const bool bMultilayerTarget = (bMultilayerExr && Target->ImageFormat == EImageFormat::EXR);
+			if ((!bCombineTargets && !bMultilayerTarget) ||
+				Target->RawOutput() != ERawImageOutput::None ||
+				Target->ClassIndexColors().Num() > 0)
+			{
+				OutTargetsQueue.Enqueue(Target);
+				continue;
+			}
+
+			// Add the target to the first compatible pass, or start a new one
+			TSharedPtr<FSinglePassTarget>* SinglePass = SinglePasses.FindByPredicate(
+				[&Target](const TSharedPtr<FSinglePassTarget>& Pass) { return Pass->AcceptsTarget(Target); });
+			if (SinglePass == nullptr)
+			{
+				SinglePass = &SinglePasses.Add_GetRef(MakeShared<FSinglePassTarget>(
+					TextureStyleManager, Target->ImageFormat, Target->TextureStyle(), bMultilayerExr));
+			}
+			(*SinglePass)->AddTarget(Target);
+		}
+	}
+
+	for (const TSharedPtr<FSinglePassTarget>& SinglePass : SinglePasses)
+	{
+		// A pass with a single target gains nothing over the regular target rendering
+		if (SinglePass->NumTargets() == 1)
+		{
+			OutTargetsQueue.Enqueue(SinglePass->FirstTarget());
+		}
+		else
+		{
+			OutTargetsQueue.Enqueue(SinglePass);
 		}
 	}
 }
@@ -82,20 +158,43 @@ TSharedPtr<FRendererTarget> FRendererTargetOptions::RendererTarget(
 	{
 	case COLOR_IMAGE: return MakeShared<FColorImageTarget>(TextureStyleManager, OutputFormat); break;
 	case DEPTH_IMAGE: return MakeShared<FDepthImageTarget>(
-		TextureStyleManager, OutputFormat, DepthRangeMetersValue); break;
+		TextureStyleManager, OutputFormat, DepthRangeMetersValue, bDepthInMeters); break;
 	case NORMAL_IMAGE: return MakeShared<FNormalImageTarget>(TextureStyleManager, OutputFormat); break;
 	case OPTICAL_FLOW_IMAGE: return MakeShared<FOpticalFlowImageTarget>(
-		TextureStyleManager, OutputFormat, OpticalFlowScaleValue); break;
-	case SEMANTIC_IMAGE: return MakeShared<FSemanticImageTarget>(TextureStyleManager, OutputFormat); break;
+		TextureStyleManager, OutputFormat, OpticalFlowScaleValue, bOpticalFlowInPixels); break;
+	case SEMANTIC_IMAGE: return MakeShared<FSemanticImageTarget>(
+		TextureStyleManager, OutputFormat, bSemanticClassIndices); break;
 	case CUSTOM_PP_MATERIAL: return MakeShared<FCustomPPMaterialTarget>(
 		TextureStyleManager, OutputFormat, Cast<UMaterial>(CustomPostProcessMaterialAssetData.GetAsset())); break;
 	default: return nullptr;
 	}
 }
 
+FString FRenderProgress::ToString() const
+{
+	const float Percentage = (FramesTotal > 0) ? 100.0f * FramesCompleted / FramesTotal : 0.0f;
+	const FString Eta = (EtaSeconds >= 0.0f) ? FTimespan::FromSeconds(EtaSeconds).ToString(TEXT("%h:%m:%s")) : TEXT("unknown");
+	return FString::Printf(TEXT("camera %d/%d, target %s, frames %d/%d (%.1f%%), %.2f fps, %.2f MB/s, ETA %s"),
+		CameraIndex + 1, NumCameras, *TargetName, FramesCompleted, FramesTotal, Percentage,
+		FramesPerSecond, MegabytesPerSecond, *Eta);
+}
+
 USequenceRenderer::USequenceRenderer() :
 	EasySynthMoviePipelineConfig(DuplicateObject<UMoviePipelinePrimaryConfig>(
 		LoadObject<UMoviePipelinePrimaryConfig>(nullptr, *FPathUtils::DefaultMoviePipelineConfigPath()), nullptr)),
+	ActiveExecutor(nullptr),
+	FrameRange(TRange<int32>::All()),
+	InitialFramesCompleted(0),
+	RenderQueueFilePath(FPathUtils::RenderQueueFilePath(FPathUtils::DefaultRenderingOutputPath())),
+	CurrentQueueEntryId(INDEX_NONE),
+	NumFailedQueueEntries(0),
+	bProcessingQueue(false),
+	RenderStartTime(0.0),
+	JobStartTime(0.0),
+	RunningJobImageFormat(EImageFormat::Invalid),
+	RunningJobNumFrames(0),
+	JobStartRecordedFiles(0),
+	JobStartRecordedBytes(0),
 	bCurrentlyRendering(false),
 	ErrorMessage("")
 {
@@ -106,6 +205,16 @@ USequenceRenderer::USequenceRenderer() :
 		UE_LOG(LogEasySynth, Error, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
 		check(EasySynthMoviePipelineConfig)
 	}
+
+	// Remember output settings that single pass rendering modifies
+	UMoviePipelineOutputSetting* OutputSetting = EasySynthMoviePipelineConfig->FindSetting<UMoviePipelineOutputSetting>();
+	if (OutputSetting != nullptr)
+	{
+		DefaultFileNameFormat = OutputSetting->FileNameFormat;
+	}
+	UMoviePipelineImageSequenceOutput_EXRLocal* ExrSetting =
+		EasySynthMoviePipelineConfig->FindSetting<UMoviePipelineImageSequenceOutput_EXRLocal>();
+	bDefaultExrMultilayer = (ExrSetting == nullptr || ExrSetting->bMultilayer);
 }
 
 bool USequenceRenderer::RenderSequence(
@@ -148,77 +257,57 @@ bool USequenceRenderer::RenderSequence(
 		return false;
 	}
 
-	// Store parameters
-	RendererTargetOptions = RenderingTargets;
-	OutputResolution = OutputImageResolution;
-	RenderingDirectory = OutputDirectory;
-
-	// Find the sequencer source actor
-	FSequencerWrapper SequencerWrapper;
-	if (!SequencerWrapper.OpenSequence(RenderingSequence))
+	// Depth in meters is written as float values, which only EXR files support
+	if (RenderingTargets.DepthInMeters() &&
+		RenderingTargets.TargetSelected(FRendererTargetOptions::TargetType::DEPTH_IMAGE) &&
+		RenderingTargets.OutputFormat(FRendererTargetOptions::TargetType::DEPTH_IMAGE) != EImageFormat::EXR)
 	{
-		ErrorMessage = "Sequencer wrapper opening failed";
+		ErrorMessage = "Depth in meters requires the EXR output format";
 		UE_LOG(LogEasySynth, Warning, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
 		return false;
 	}
 
-	// Assume the same source actor is used for all camera cuts
-	TArray<UMovieSceneCameraCutSection*> CutSections = SequencerWrapper.GetMovieSceneCutSections();
-	if (CutSections.Num() == 0)
-	{
-		UE_LOG(LogEasySynth, Warning, TEXT("%s: No sections inside the camera cut track"), *FString(__FUNCTION__))
-		return false;
-	}
-	UMovieSceneCameraCutSection* CutSection = CutSections[0];
-
-	// Get the sequence source actor
-	TArrayView<TWeakObjectPtr<>> SourceObjects = SequencerWrapper.GetSequencer()->FindBoundObjects(
-		CutSection->GetCameraBindingID().GetGuid(),
-		SequencerWrapper.GetSequencer()->GetFocusedTemplateID());
-	if (SourceObjects.Num() == 0)
+	// Optical flow in pixels is written as float values, which only EXR files support
+	if (RenderingTargets.OpticalFlowInPixels() &&
+		RenderingTargets.TargetSelected(FRendererTargetOptions::TargetType::OPTICAL_FLOW_IMAGE) &&
+		RenderingTargets.OutputFormat(FRendererTargetOptions::TargetType::OPTICAL_FLOW_IMAGE) != EImageFormat::EXR)
 	{
-		ErrorMessage = "No sources assigned to the sequencer";
+		ErrorMessage = "Optical flow in pixels requires the EXR output format";
 		UE_LOG(LogEasySynth, Warning, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
 		return false;
 	}
 
-	// Assume the same source actor is used throughout the camera cut
-	CameraRigActor = Cast<AActor>(SourceObjects[0].Get());
-	if (CameraRigActor == nullptr)
+	// Class indices are written as grayscale PNG images
+	if (RenderingTargets.SemanticClassIndices() &&
+		RenderingTargets.TargetSelected(FRendererTargetOptions::TargetType::SEMANTIC_IMAGE) &&
+		RenderingTargets.OutputFormat(FRendererTargetOptions::TargetType::SEMANTIC_IMAGE) != EImageFormat::PNG)
 	{
-		ErrorMessage = "Expected an actor as a sequence source";
+		ErrorMessage = "Semantic class indices require the PNG output format";
 		UE_LOG(LogEasySynth, Warning, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
 		return false;
 	}
 
-	// Prepare rig cameras information
-	RigCameras.Empty();
-	CurrentRigCameraId = -1;
+	// Store parameters
+	RendererTargetOptions = RenderingTargets;
+	OutputResolution = OutputImageResolution;
+	RenderingDirectory = OutputDirectory;
 
-	// Find all camera components inside the source actor
-	TArray<UActorComponent*> ActorComponents;
-	const bool bIncludeFromChildActors = true;
-	CameraRigActor->GetComponents(UCameraComponent::StaticClass(), ActorComponents, bIncludeFromChildActors);
+	// Start collecting stage timings of the run
+	FRenderTelemetry::Get().Reset();
+	RenderStartTime = FPlatformTime::Seconds();
 
-	// If no mesh components are found, ignore the actor
-	if (ActorComponents.Num() == 0)
+	// Find the sequencer source actor and its cameras
+	FSequencerWrapper SequencerWrapper;
+	CurrentRigCameraId = -1;
+	if (!FindRigCameras(RenderingSequence, SequencerWrapper, CameraRigActor, RigCameras))
 	{
-		ErrorMessage = "No cameras found inside the actor";
 		UE_LOG(LogEasySynth, Warning, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
 		return false;
 	}
 
-	// Store pointers to all cameras inside the rig for later selection of the active camera
-	for (UActorComponent* ActorComponent : ActorComponents)
+	// Adjust all rig cameras to the output resolution
+	for (UCameraComponent* CameraComponent : RigCameras)
 	{
-		UCameraComponent* CameraComponent = Cast<UCameraComponent>(ActorComponent);
-		if (CameraComponent == nullptr)
-		{
-			ErrorMessage = "Got null camera component";
-			UE_LOG(LogEasySynth, Error, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
-			return false;
-		}
-
 		// Set required camera aspect ratio
 		const float AspectRatio = 1.0f * OutputResolution.X / OutputResolution.Y;
 		UCineCameraComponent* CineCameraComponent = Cast<UCineCameraComponent>(CameraComponent);
@@ -232,8 +321,22 @@ bool USequenceRenderer::RenderSequence(
 		}
 		CameraComponent->SetAspectRatio(AspectRatio);
 		CameraComponent->SetConstraintAspectRatio(true);
+	}
+
+	// Overridden rig cameras are restored once the rendering finishes, or right away if it fails to start
+	ON_SCOPE_EXIT
+	{
+		if (!bCurrentlyRendering)
+		{
+			RestoreCameraRigOverride();
+		}
+	};
 
-		RigCameras.Add(CameraComponent);
+	// Override rig cameras using the provided camera rig file
+	if (!CameraRigOverridePath.IsEmpty() && !ApplyCameraRigOverride())
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
+		return false;
 	}
 
 	// Make sure the camera rig array is sorted by the camera id
@@ -250,248 +353,1115 @@ bool USequenceRenderer::RenderSequence(
 		return false;
 	}
 
-	// Export camera rig poses if requested
+	// Export camera rig poses and poses of all rig cameras if requested
 	if (RendererTargetOptions.ExportCameraPoses())
 	{
-		FCameraPoseExporter CameraPoseExporter;
-		UCameraComponent* NoSpecificCamera = nullptr;
-		if (!CameraPoseExporter.ExportCameraPoses(
-			RenderingSequence, OutputResolution, RenderingDirectory, NoSpecificCamera))
+		if (!ExportCameraPoses())
 		{
-			ErrorMessage = "Could not export camera rig poses";
+			ErrorMessage = "Could not export camera poses";
 			UE_LOG(LogEasySynth, Error, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
 			return false;
 		}
 	}
 
-	// Export semantic class information if semantic rendering is selected
-	if (RendererTargetOptions.TargetSelected(FRendererTargetOptions::TargetType::SEMANTIC_IMAGE))
+	// Export poses of objects bound to the sequence if requested
+	if (RendererTargetOptions.ExportObjectPoses())
 	{
-		if (!TextureStyleManager->ExportSemanticClasses(RenderingDirectory))
+		if (!ExportObjectPoses())
 		{
-			ErrorMessage = "Could not save the semantic class CSV file";
+			ErrorMessage = "Could not export object poses";
 			UE_LOG(LogEasySynth, Error, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
 			return false;
 		}
 	}
 
-	OriginalTextureStyle = TextureStyleManager->SelectedTextureStyle();
-
-	UE_LOG(LogEasySynth, Log, TEXT("%s: Rendering..."), *FString(__FUNCTION__))
-	bCurrentlyRendering = true;
-
-	FindNextCamera();
-
-	return true;
-}
-
-void USequenceRenderer::OnExecutorFinished(UMoviePipelineExecutorBase* InPipelineExecutor, bool bSuccess)
-{
-	// Revert target specific modifications to the sequence
-	if (!CurrentTarget->FinalizeSequence(RenderingSequence))
+	// Export bounding boxes of labeled actors if requested
+	if (RendererTargetOptions.ExportBoundingBoxes())
 	{
-		ErrorMessage = FString::Printf(TEXT("Failed while finalizing the rendering of the %s target"), *CurrentTarget->Name());
-		return BroadcastRenderingFinished(false);
+		if (!ExportBoundingBoxes())
+		{
+			ErrorMessage = "Could not export bounding boxes";
+			UE_LOG(LogEasySynth, Error, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
+			return false;
+		}
 	}
 
-	if (!bSuccess)
+	// Export rig IMU samples if a sample rate is selected
+	if (RendererTargetOptions.ImuRateHz() > 0.0f)
 	{
-		ErrorMessage = FString::Printf(TEXT("Failed while rendering the %s target"), *CurrentTarget->Name());
-		return BroadcastRenderingFinished(false);
+		if (!ExportImuSamples())
+		{
+			ErrorMessage = "Could not export IMU samples";
+			UE_LOG(LogEasySynth, Error, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
+			return false;
+		}
 	}
 
-	// Successful rendering, proceed to the next target
-	FindNextTarget();
-}
-
-void USequenceRenderer::FindNextCamera()
-{
-	CurrentRigCameraId++;
+	// Export semantic class information if semantic rendering is selected
+	if (RendererTargetOptions.TargetSelected(FRendererTargetOptions::TargetType::SEMANTIC_IMAGE))
+	{
+		if (!TextureStyleManager->ExportSemanticClasses(RenderingDirectory))
+		{
+			ErrorMessage = "Could not save the semantic class CSV file";
+			UE_LOG(LogEasySynth, Error, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
+			return false;
+		}
+		if (RendererTargetOptions.SemanticClassIndices() &&
+			!TextureStyleManager->ExportSemanticClassIndices(RenderingDirectory))
+		{
+			ErrorMessage = "Could not save the semantic class indices CSV file";
+			UE_LOG(LogEasySynth, Error, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
+			return false;
+		}
+	}
 
-	// Check if the end is reached
-	if (CurrentRigCameraId == RigCameras.Num())
+	// Resolve the rendered frame range
+	RenderFrameRange = FSequencerWrapper::PlaybackFrameRange(RenderingSequence);
+	if (FrameRange.HasLowerBound() && FrameRange.HasUpperBound())
 	{
-		return BroadcastRenderingFinished(true);
+		RenderFrameRange = TRange<int32>::Intersection(RenderFrameRange, FrameRange);
+	}
+	if (RenderFrameRange.IsEmpty())
+	{
+		ErrorMessage = "No frames to be rendered inside the requested frame range";
+		UE_LOG(LogEasySynth, Error, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
+		return false;
 	}
 
-	if (CurrentRigCameraId == 0)
+	// Open the manifest of rendered frames, previous progress is kept only when resuming
+	if (!RenderManifest.Open(RenderingDirectory, RendererTargetOptions.ResumeRendering()))
 	{
-		// Remember the transform of the first camera
-		OriginalCameraTransform = RigCameras[0]->GetRelativeTransform();
-		OriginalCameraFOV = RigCameras[0]->FieldOfView;
+		ErrorMessage = "Could not open the render manifest";
+		UE_LOG(LogEasySynth, Error, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
+		return false;
 	}
-	else
+
+	// Images are packed into dataset shards by their write tasks instead of being written, if requested
+	DatasetShardPacker.Reset();
+	if (RendererTargetOptions.DatasetShardSizeMegabytes() > 0 && !StartDatasetShards())
 	{
-		// Transfer the transform of the current camera to the first one that is used for rendering
-		RigCameras[0]->SetRelativeTransform(RigCameras[CurrentRigCameraId]->GetRelativeTransform());
-		RigCameras[0]->SetFieldOfView(RigCameras[CurrentRigCameraId]->FieldOfView);
+		ErrorMessage = "Could not start packing dataset shards";
+		UE_LOG(LogEasySynth, Error, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
+		return false;
 	}
 
-	// Export camera poses if requested
-	if (RendererTargetOptions.ExportCameraPoses())
+	// Collect outputs of all targets to track the rendering progress and to pack them together
+	TQueue<TSharedPtr<FRendererTarget>> ProgressTargets;
+	RendererTargetOptions.GetSelectedTargets(TextureStyleManager, ProgressTargets);
+	ProgressTargetOutputs.Empty();
+	TSharedPtr<FRendererTarget> ProgressTarget;
+	while (ProgressTargets.Dequeue(ProgressTarget))
 	{
-		FCameraPoseExporter CameraPoseExporter;
-		if (!CameraPoseExporter.ExportCameraPoses(
-			RenderingSequence, OutputResolution, RenderingDirectory, RigCameras[CurrentRigCameraId]))
+		ProgressTargetOutputs.Add(ProgressTarget->OutputNames());
+		if (DatasetShardPacker.IsValid())
 		{
-			ErrorMessage = "Could not export camera poses";
-			return BroadcastRenderingFinished(false);
+			DatasetShardPacker->AddTarget(ProgressTarget->OutputNames());
 		}
 	}
+	FDatasetShardPacker::SetActive(DatasetShardPacker);
+	RenderProgress = FRenderProgress();
+	InitialFramesCompleted = CountRenderedFrames();
+	RenderProgress.FramesCompleted = InitialFramesCompleted;
 
-	// Prepare the targets queue
-	RendererTargetOptions.GetSelectedTargets(TextureStyleManager, TargetsQueue);
-	CurrentTarget = nullptr;
+	OriginalTextureStyle = TextureStyleManager->SelectedTextureStyle();
 
-	UE_LOG(LogEasySynth, Log, TEXT("%s: Rendering camera %d/%d"), *FString(__FUNCTION__), CurrentRigCameraId + 1, RigCameras.Num())
+	// Remember the transform of the first camera, as it is used to render all rig cameras
+	OriginalCameraTransform = RigCameras[0]->GetRelativeTransform();
+	OriginalCameraFOV = RigCameras[0]->FieldOfView;
 
-	// Find the next target and start rendering
-	FindNextTarget();
-}
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Rendering..."), *FString(__FUNCTION__))
+	bCurrentlyRendering = true;
+	ErrorMessage = "";
 
-void USequenceRenderer::FindNextTarget()
-{
-	// Check if the end is reached
-	if (TargetsQueue.IsEmpty())
+	// Periodically record frames whose write tasks completed, so they are not rendered again after a crash,
+	// and report the progress based on them
+	const bool bLoop = true;
+	GEditor->GetEditorWorldContext().World()->GetTimerManager().SetTimer(
+		ProgressTimerHandle,
+		FTimerDelegate::CreateUObject(this, &USequenceRenderer::UpdateProgress),
+		ProgressUpdateIntervalSeconds,
+		bLoop);
+
+	if (RendererTargetOptions.ParallelRigRendering())
 	{
-		return FindNextCamera();
+		StartRigRendering();
 	}
-
-	// Select the next requested target
-	TargetsQueue.Dequeue(CurrentTarget);
-
-	// Setup specifics of the current rendering target
-	UE_LOG(LogEasySynth, Log, TEXT("%s: Rendering the %s target"), *FString(__FUNCTION__), *CurrentTarget->Name())
-	if (!CurrentTarget->PrepareSequence(RenderingSequence))
+	else
 	{
-		ErrorMessage = FString::Printf(TEXT("Failed while preparing the rendering of the %s target"), *CurrentTarget->Name());
-		return BroadcastRenderingFinished(false);
+		FindNextCamera();
 	}
 
-	// Start the rendering after a brief pause
-	const float DelaySeconds = 2.0f;
-	const bool bLoop = false;
-	GEditor->GetEditorWorldContext().World()->GetTimerManager().SetTimer(
-		RendererPauseTimerHandle,
-		this,
-		&USequenceRenderer::StartRendering,
-		DelaySeconds,
-		bLoop);
+	return true;
 }
 
-void USequenceRenderer::StartRendering()
+bool USequenceRenderer::EstimateRenderCost(
+	const FAssetData& LevelSequenceAssetData,
+	const FRendererTargetOptions& RenderingTargets,
+	const FIntPoint OutputImageResolution,
+	const FString& OutputDirectory,
+	FRenderCostEstimate& OutEstimate)
 {
-	// Make sure the sequence is still sound
-	if (RenderingSequence == nullptr)
+	OutEstimate = FRenderCostEstimate();
+
+	// Opening the sequence would interfere with the running rendering
+	if (bCurrentlyRendering)
 	{
-		ErrorMessage = "Provided level sequence is null when starting the recording";
-		return BroadcastRenderingFinished(false);
+		ErrorMessage = "Rendering already in progress";
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
+		return false;
 	}
 
-	// Make sure a renderer target is selected
-	if (!CurrentTarget.IsValid())
+	ULevelSequence* LevelSequence = Cast<ULevelSequence>(LevelSequenceAssetData.GetAsset());
+	if (LevelSequence == nullptr)
 	{
-		ErrorMessage = "Current renderer target null when starting the recording";
-		return BroadcastRenderingFinished(false);
+		ErrorMessage = "Provided level sequence is null";
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
+		return false;
 	}
 
-	// Get the movie rendering editor subsystem
-	UMoviePipelineQueueSubsystem* MoviePipelineQueueSubsystem =
-		GEditor->GetEditorSubsystem<UMoviePipelineQueueSubsystem>();
-	if (MoviePipelineQueueSubsystem == nullptr)
+	if (!RenderingTargets.AnyOptionSelected())
 	{
-		ErrorMessage = "Could not get the UMoviePipelineQueueSubsystem";
-		return BroadcastRenderingFinished(false);
+		ErrorMessage = "No rendering targets selected";
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
+		return false;
 	}
 
-	// Add received level sequence to the queue as a new job
-	if (!PrepareJobQueue(MoviePipelineQueueSubsystem))
+	// Count cameras the same way the rendering finds them, without changing them
+	FSequencerWrapper SequencerWrapper;
+	AActor* EstimatedRigActor = nullptr;
+	TArray<UCameraComponent*> EstimatedRigCameras;
+	if (!FindRigCameras(LevelSequence, SequencerWrapper, EstimatedRigActor, EstimatedRigCameras))
 	{
-		// Propagate the error message set inside the PrepareJobQueue
-		return BroadcastRenderingFinished(false);
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
+		return false;
 	}
 
-	// Get the default movie rendering settings
-	const UMovieRenderPipelineProjectSettings* ProjectSettings = GetDefault<UMovieRenderPipelineProjectSettings>();
-	if (ProjectSettings->DefaultLocalExecutor == nullptr)
+	OutEstimate.NumFrames = SequencerWrapper.CutSectionFrameCount(FrameRange);
+	OutEstimate.NumCameras = EstimatedRigCameras.Num();
+
+	// Previous runs of the project provide the rendering speed and the output size of each target
+	TMap<FString, FRenderTelemetry::FFrameCost> FrameCosts;
+	if (!FRenderTelemetry::LoadFrameCosts(OutputImageResolution, FrameCosts))
 	{
-		ErrorMessage = "Could not get the UMovieRenderPipelineProjectSettings";
-		return BroadcastRenderingFinished(false);
+		UE_LOG(LogEasySynth, Log, TEXT("%s: No render history found at %s"),
+			*FString(__FUNCTION__), *FPathUtils::RenderHistoryFilePath())
 	}
 
-	// Run the rendering
-	UMoviePipelineExecutorBase* ActiveExecutor =
-		MoviePipelineQueueSubsystem->RenderQueueWithExecutor(ProjectSettings->DefaultLocalExecutor.ResolveClass());
-	if (ActiveExecutor == nullptr)
+	// Targets are estimated as they would be rendered, so single pass targets match their recorded timings
+	TQueue<TSharedPtr<FRendererTarget>> EstimatedTargets;
+	RenderingTargets.GetSelectedTargets(TextureStyleManager, EstimatedTargets);
+	TSharedPtr<FRendererTarget> Target;
+	while (EstimatedTargets.Dequeue(Target))
 	{
-		ErrorMessage = "Could not start the rendering";
-		return BroadcastRenderingFinished(false);
+		OutEstimate.AddTarget(
+			Target->Name(),
+			Target->ImageFormat,
+			Target->OutputNames().Num(),
+			OutputImageResolution,
+			FrameCosts.Find(FRenderTelemetry::JobName(Target->Name(), Target->ImageFormat)));
 	}
 
-	// Assign rendering finished callback
-	ActiveExecutor->OnExecutorFinished().AddUObject(this, &USequenceRenderer::OnExecutorFinished);
+	OutEstimate.CheckFreeDiskSpace(OutputDirectory);
+	if (OutEstimate.bExceedsFreeDiskSpace)
+	{
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: Estimated output size of %lld bytes exceeds %lld bytes of free disk space"),
+			*FString(__FUNCTION__), OutEstimate.TotalBytes, OutEstimate.FreeDiskBytes)
+	}
+
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Estimated cost of rendering %s:%s%s"),
+		*FString(__FUNCTION__), *LevelSequenceAssetData.AssetName.ToString(), LINE_TERMINATOR, *OutEstimate.ToString())
+
+	return true;
 }
 
-bool USequenceRenderer::PrepareJobQueue(UMoviePipelineQueueSubsystem* MoviePipelineQueueSubsystem)
+bool USequenceRenderer::FindRigCameras(
+	ULevelSequence* LevelSequence,
+	FSequencerWrapper& SequencerWrapper,
+	AActor*& OutCameraRigActor,
+	TArray<UCameraComponent*>& OutRigCameras)
 {
-	check(MoviePipelineQueueSubsystem)
+	OutCameraRigActor = nullptr;
+	OutRigCameras.Empty();
 
-	// Update export image format
-	UMoviePipelineSetting* JpegSetting = EasySynthMoviePipelineConfig->FindOrAddSettingByClass(
-		UMoviePipelineImageSequenceOutput_JPG::StaticClass(), true);
-	UMoviePipelineSetting* PngSetting = EasySynthMoviePipelineConfig->FindSettingByClass(
-		UMoviePipelineImageSequenceOutput_PNG::StaticClass(), true);
-	UMoviePipelineSetting* ExrSetting = EasySynthMoviePipelineConfig->FindOrAddSettingByClass(
-		UMoviePipelineImageSequenceOutput_EXRLocal::StaticClass(), true);
-	if (JpegSetting == nullptr || PngSetting == nullptr || ExrSetting == nullptr)
+	if (!SequencerWrapper.OpenSequence(LevelSequence))
 	{
-		ErrorMessage = "JPEG, PNG or EXR settings not found";
+		ErrorMessage = "Sequencer wrapper opening failed";
 		return false;
 	}
-	JpegSetting->SetIsEnabled(CurrentTarget->ImageFormat == EImageFormat::JPEG);
-	PngSetting->SetIsEnabled(CurrentTarget->ImageFormat == EImageFormat::PNG);
-	ExrSetting->SetIsEnabled(CurrentTarget->ImageFormat == EImageFormat::EXR);
 
-	// Update pipeline output settings for the current target
-	UMoviePipelineOutputSetting* OutputSetting =
-		EasySynthMoviePipelineConfig->FindSetting<UMoviePipelineOutputSetting>();
-	if (OutputSetting == nullptr)
+	// Assume the same source actor is used for all camera cuts
+	TArray<UMovieSceneCameraCutSection*> CutSections = SequencerWrapper.GetMovieSceneCutSections();
+	if (CutSections.Num() == 0)
 	{
-		ErrorMessage = "Could not find the output setting inside the default config";
+		ErrorMessage = "No sections inside the camera cut track";
 		return false;
 	}
-	// Update the image output directory
-	OutputSetting->OutputDirectory.Path =
-		FPathUtils::RigCameraDir(RenderingDirectory, RigCameras[CurrentRigCameraId]) / CurrentTarget->Name();
-	OutputSetting->OutputResolution = OutputResolution;
+	UMovieSceneCameraCutSection* CutSection = CutSections[0];
 
-	// Get the queue of sequences to be renderer
-	UMoviePipelineQueue* MoviePipelineQueue = MoviePipelineQueueSubsystem->GetQueue();
-	if (MoviePipelineQueue == nullptr)
+	// Get the sequence source actor
+	TArrayView<TWeakObjectPtr<>> SourceObjects = SequencerWrapper.GetSequencer()->FindBoundObjects(
+		CutSection->GetCameraBindingID().GetGuid(),
+		SequencerWrapper.GetSequencer()->GetFocusedTemplateID());
+	if (SourceObjects.Num() == 0)
 	{
-		ErrorMessage = "Could not get the UMoviePipelineQueue";
+		ErrorMessage = "No sources assigned to the sequencer";
 		return false;
 	}
-	MoviePipelineQueue->Modify();
 
-	// Clear the current queue
-	TArray<UMoviePipelineExecutorJob*> ExistingJobs = MoviePipelineQueue->GetJobs();
-	for (UMoviePipelineExecutorJob* MoviePipelineExecutorJob : ExistingJobs)
+	// Assume the same source actor is used throughout the camera cut
+	OutCameraRigActor = Cast<AActor>(SourceObjects[0].Get());
+	if (OutCameraRigActor == nullptr)
+	{
+		ErrorMessage = "Expected an actor as a sequence source";
+		return false;
+	}
+
+	// Find all camera components inside the source actor
+	TArray<UActorComponent*> ActorComponents;
+	const bool bIncludeFromChildActors = true;
+	OutCameraRigActor->GetComponents(UCameraComponent::StaticClass(), ActorComponents, bIncludeFromChildActors);
+
+	// If no camera components are found, ignore the actor
+	if (ActorComponents.Num() == 0)
+	{
+		ErrorMessage = "No cameras found inside the actor";
+		return false;
+	}
+
+	// Store pointers to all cameras inside the rig for later selection of the active camera
+	for (UActorComponent* ActorComponent : ActorComponents)
+	{
+		UCameraComponent* CameraComponent = Cast<UCameraComponent>(ActorComponent);
+		if (CameraComponent == nullptr)
+		{
+			ErrorMessage = "Got null camera component";
+			OutRigCameras.Empty();
+			return false;
+		}
+		OutRigCameras.Add(CameraComponent);
+	}
+
+	return true;
+}
+
+USequenceRenderer* USequenceRenderer::GetEditorSequenceRenderer()
+{
+	return FindObject<USequenceRenderer>(GetTransientPackage(), *EditorRendererName.ToString());
+}
+
+bool USequenceRenderer::RenderSequences(const TArray<FSequenceRenderJob>& Jobs)
+{
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Queueing %d sequences"), *FString(__FUNCTION__), Jobs.Num())
+
+	// Pick up entries left by an interrupted session before adding new ones
+	if (!bProcessingQueue && !LoadRenderQueue())
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
+		return false;
+	}
+
+	UWorld* World = GEditor->GetEditorWorldContext().World();
+	for (const FSequenceRenderJob& Job : Jobs)
+	{
+		FRenderQueueEntry Entry;
+		Entry.job = FRenderJobSpec::FromRendererTargetOptions(Job.TargetOptions);
+		Entry.job.map = World->GetOutermost()->GetName();
+		Entry.job.level_sequences.Add(Job.LevelSequenceAssetData.GetSoftObjectPath().ToString());
+		Entry.job.resolution = { Job.OutputResolution.X, Job.OutputResolution.Y };
+		Entry.job.output_dir = Job.OutputDirectory;
+		Entry.job.camera_rig = CameraRigOverridePath;
+		Entry.status = FRenderQueueEntry::StatusPending;
+
+		// Sequences still waiting from an interrupted session are not added twice
+		const bool bAlreadyQueued = RenderQueue.jobs.ContainsByPredicate([&Entry](const FRenderQueueEntry& QueuedEntry) {
+			return QueuedEntry.status == FRenderQueueEntry::StatusPending &&
+				QueuedEntry.job.level_sequences == Entry.job.level_sequences &&
+				QueuedEntry.job.output_dir == Entry.job.output_dir;
+		});
+		if (!bAlreadyQueued)
+		{
+			RenderQueue.jobs.Add(Entry);
+		}
+	}
+
+	if (!SaveRenderQueue())
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
+		return false;
+	}
+
+	// New entries are picked up by the running queue once it reaches them
+	if (!bProcessingQueue)
+	{
+		bProcessingQueue = true;
+		NumFailedQueueEntries = 0;
+		RenderNextQueueEntry();
+	}
+
+	return true;
+}
+
+void USequenceRenderer::SetRenderQueueFilePath(const FString& FilePath)
+{
+	if (bProcessingQueue)
+	{
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: Cannot change the render queue file while processing the queue"),
+			*FString(__FUNCTION__))
+		return;
+	}
+	RenderQueueFilePath = FilePath;
+}
+
+void USequenceRenderer::OnExecutorFinished(UMoviePipelineExecutorBase* InPipelineExecutor, bool bSuccess)
+{
+	ActiveExecutor = nullptr;
+	FinishJobTiming(bSuccess);
+
+	// Record the frames rendered by the last job, it is complete only if rendering succeeded
+	RecordRenderedFrames(bSuccess);
+	BroadcastProgress();
+
+	// Revert target specific modifications to the sequence
+	if (CurrentTarget.IsValid() && !FinalizeTarget(CurrentTarget))
+	{
+		ErrorMessage = FString::Printf(TEXT("Failed while finalizing the rendering of the %s target"), *CurrentTarget->Name());
+		return BroadcastRenderingFinished(false);
+	}
+
+	if (!bSuccess)
+	{
+		ErrorMessage = FString::Printf(TEXT("Failed while rendering the %s target"), *CurrentTarget->Name());
+		return BroadcastRenderingFinished(false);
+	}
+
+	// Successful rendering, proceed to the next target
+	if (RigCameraBindings.Num() > 0)
+	{
+		return RenderNextRigTarget();
+	}
+	FindNextTarget();
+}
+
+void USequenceRenderer::OnIndividualJobStarted(UMoviePipelineExecutorJob* StartedJob)
+{
+	// The executor starts jobs in order, so the previous job is done
+	const bool bPreviousJobSucceeded = true;
+	FinishJobTiming(bPreviousJobSucceeded);
+
+	// The rig rendering renders each job frame once for each rig camera
+	const int32 NumJobCameras = (CurrentRigCameraId == INDEX_NONE) ? RigCameras.Num() : 1;
+	StartJobTiming(CurrentTarget, NumJobCameras * JobFrameRange(CurrentTarget, CurrentRigCameraId).Size<int32>());
+}
+
+void USequenceRenderer::FindNextCamera()
+{
+	CurrentRigCameraId++;
+
+	// Check if the end is reached
+	if (CurrentRigCameraId == RigCameras.Num())
+	{
+		return BroadcastRenderingFinished(true);
+	}
+
+	// Transfer the transform of the current camera to the first one that is used for rendering
+	SelectRigCamera(CurrentRigCameraId);
+
+	// Prepare the targets queue
+	RendererTargetOptions.GetSelectedTargets(TextureStyleManager, TargetsQueue);
+	CurrentTarget = nullptr;
+
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Rendering camera %d/%d"), *FString(__FUNCTION__), CurrentRigCameraId + 1, RigCameras.Num())
+
+	// Find the next target and start rendering
+	FindNextTarget();
+}
+
+void USequenceRenderer::FindNextTarget()
+{
+	// Check if the end is reached
+	if (TargetsQueue.IsEmpty())
+	{
+		return FindNextCamera();
+	}
+
+	// Select the next requested target
+	TargetsQueue.Dequeue(CurrentTarget);
+
+	// Skip targets fully rendered by a previous run
+	if (JobFrameRange(CurrentTarget, CurrentRigCameraId).IsEmpty())
+	{
+		UE_LOG(LogEasySynth, Log, TEXT("%s: Skipping the already rendered %s target"),
+			*FString(__FUNCTION__), *CurrentTarget->Name())
+		return FindNextTarget();
+	}
+
+	// Setup specifics of the current rendering target
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Rendering the %s target"), *FString(__FUNCTION__), *CurrentTarget->Name())
+	if (!PrepareTarget(CurrentTarget))
+	{
+		ErrorMessage = FString::Printf(TEXT("Failed while preparing the rendering of the %s target"), *CurrentTarget->Name());
+		return BroadcastRenderingFinished(false);
+	}
+
+	// Start the rendering once the engine is done processing the prepared changes
+	ReadinessScheduler.Schedule(
+		FSimpleDelegate::CreateUObject(this, &USequenceRenderer::StartRendering),
+		RendererTargetOptions.ReadinessTimeout());
+}
+
+void USequenceRenderer::StartRendering()
+{
+	// Make sure the sequence is still sound
+	if (RenderingSequence == nullptr)
+	{
+		ErrorMessage = "Provided level sequence is null when starting the recording";
+		return BroadcastRenderingFinished(false);
+	}
+
+	// Make sure a renderer target is selected
+	if (!CurrentTarget.IsValid())
+	{
+		ErrorMessage = "Current renderer target null when starting the recording";
+		return BroadcastRenderingFinished(false);
+	}
+
+	// Get the movie rendering editor subsystem
+	UMoviePipelineQueueSubsystem* MoviePipelineQueueSubsystem =
+		GEditor->GetEditorSubsystem<UMoviePipelineQueueSubsystem>();
+	if (MoviePipelineQueueSubsystem == nullptr)
+	{
+		ErrorMessage = "Could not get the UMoviePipelineQueueSubsystem";
+		return BroadcastRenderingFinished(false);
+	}
+
+	// Add received level sequence to the queue as a new job
+	if (!PrepareJobQueue(MoviePipelineQueueSubsystem))
+	{
+		// Propagate the error message set inside the PrepareJobQueue
+		return BroadcastRenderingFinished(false);
+	}
+
+	// Run the rendering
+	if (!RunJobQueue(MoviePipelineQueueSubsystem))
+	{
+		// Propagate the error message set inside the RunJobQueue
+		return BroadcastRenderingFinished(false);
+	}
+}
+
+void USequenceRenderer::StartRigRendering()
+{
+	// Order targets by the texture style, so that each style is checked out once per run
+	RendererTargetOptions.GetSelectedTargets(TextureStyleManager, TargetsQueue);
+	TArray<TSharedPtr<FRendererTarget>> Targets;
+	TSharedPtr<FRendererTarget> Target;
+	while (TargetsQueue.Dequeue(Target))
+	{
+		Targets.Add(Target);
+	}
+	Targets.StableSort([](const TSharedPtr<FRendererTarget>& A, const TSharedPtr<FRendererTarget>& B) {
+		return A->TextureStyle() < B->TextureStyle();
+	});
+
+	// Skip targets fully rendered by a previous run for all rig cameras
+	for (const TSharedPtr<FRendererTarget>& RigTarget : Targets)
+	{
+		if (JobFrameRange(RigTarget, INDEX_NONE).IsEmpty())
+		{
+			UE_LOG(LogEasySynth, Log, TEXT("%s: Skipping the already rendered %s target"),
+				*FString(__FUNCTION__), *RigTarget->Name())
+			continue;
+		}
+		TargetsQueue.Enqueue(RigTarget);
+	}
+
+	// Each target is rendered by a single job, in which every rig camera renders its own view of each frame
+	if (!BindRigCameras())
+	{
+		return BroadcastRenderingFinished(false);
+	}
+
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Rendering %d cameras as views of a single job for each of %d targets"),
+		*FString(__FUNCTION__), RigCameras.Num(), Targets.Num())
+
+	CurrentTarget = nullptr;
+	RenderNextRigTarget();
+}
+
+void USequenceRenderer::RenderNextRigTarget()
+{
+	// Check if the end is reached
+	if (TargetsQueue.IsEmpty())
+	{
+		return BroadcastRenderingFinished(true);
+	}
+
+	TargetsQueue.Dequeue(CurrentTarget);
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Rendering the %s target"), *FString(__FUNCTION__), *CurrentTarget->Name())
+	if (!PrepareTarget(CurrentTarget))
+	{
+		ErrorMessage = FString::Printf(TEXT("Failed while preparing the rendering of the %s target"), *CurrentTarget->Name());
+		return BroadcastRenderingFinished(false);
+	}
+
+	// Start the job once the engine is done processing the prepared changes,
+	// including the shaders and textures of a newly checked out texture style
+	ReadinessScheduler.Schedule(
+		FSimpleDelegate::CreateUObject(this, &USequenceRenderer::StartRendering),
+		RendererTargetOptions.ReadinessTimeout());
+}
+
+bool USequenceRenderer::BindRigCameras()
+{
+	FSequencerWrapper SequencerWrapper;
+	if (!SequencerWrapper.OpenSequence(RenderingSequence) || SequencerWrapper.GetMovieSceneCutSections().Num() == 0)
+	{
+		ErrorMessage = "Sequencer wrapper opening failed";
+		return false;
+	}
+	UMovieScene* MovieScene = SequencerWrapper.GetMovieScene();
+	const FGuid RigBindingGuid = SequencerWrapper.GetMovieSceneCutSections()[0]->GetCameraBindingID().GetGuid();
+
+	// With all cameras rendered, the pipeline renders a view of each frame for every camera bound to the sequence,
+	// naming its outputs after the binding, so the bindings are named after the rig camera directories
+	for (UCameraComponent* RigCamera : RigCameras)
+	{
+		// Component bindings are resolved inside the actor bound to the camera cuts
+		if (RigCamera->GetOwner() != CameraRigActor)
+		{
+			ErrorMessage = FString::Printf(TEXT("Camera %s is not a component of the rig actor, so it cannot be rendered with the rest of the rig"),
+				*FPathUtils::GetCameraName(RigCamera));
+			UnbindRigCameras();
+			return false;
+		}
+
+		const FGuid BindingGuid = MovieScene->AddPossessable(FPathUtils::GetCameraName(RigCamera), RigCamera->GetClass());
+		FMovieScenePossessable* Possessable = MovieScene->FindPossessable(BindingGuid);
+		if (Possessable == nullptr)
+		{
+			ErrorMessage = FString::Printf(TEXT("Could not bind the camera %s to the sequence"), *FPathUtils::GetCameraName(RigCamera));
+			UnbindRigCameras();
+			return false;
+		}
+		Possessable->SetParent(RigBindingGuid, MovieScene);
+		RenderingSequence->BindPossessableObject(BindingGuid, *RigCamera, CameraRigActor);
+		RigCameraBindings.Add(BindingGuid);
+	}
+
+	return true;
+}
+
+void USequenceRenderer::UnbindRigCameras()
+{
+	if (RigCameraBindings.Num() == 0 || RenderingSequence == nullptr)
+	{
+		RigCameraBindings.Empty();
+		return;
+	}
+
+	UMovieScene* MovieScene = RenderingSequence->GetMovieScene();
+	for (const FGuid& BindingGuid : RigCameraBindings)
+	{
+		RenderingSequence->UnbindPossessableObjects(BindingGuid);
+		MovieScene->RemovePossessable(BindingGuid);
+	}
+	RigCameraBindings.Empty();
+}
+
+void USequenceRenderer::SelectRigCamera(const int RigCameraId)
+{
+	// The first rig camera is the one used for rendering,
+	// so it takes over the transform of the selected camera
+	if (RigCameraId == 0)
+	{
+		RigCameras[0]->SetRelativeTransform(OriginalCameraTransform);
+		RigCameras[0]->SetFieldOfView(OriginalCameraFOV);
+	}
+	else
+	{
+		RigCameras[0]->SetRelativeTransform(RigCameras[RigCameraId]->GetRelativeTransform());
+		RigCameras[0]->SetFieldOfView(RigCameras[RigCameraId]->FieldOfView);
+	}
+}
+
+TRange<int32> USequenceRenderer::JobFrameRange(const TSharedPtr<FRendererTarget>& Target, const int RigCameraId) const
+{
+	if (!RendererTargetOptions.ResumeRendering())
+	{
+		return RenderFrameRange;
+	}
+
+	// Render the smallest range covering frames missing from any of the target outputs of any of the job cameras
+	TArray<UCameraComponent*> JobCameras = RigCameras;
+	if (RigCameraId != INDEX_NONE)
+	{
+		JobCameras = { RigCameras[RigCameraId] };
+	}
+	TRange<int32> MissingRange = TRange<int32>::Empty();
+	for (UCameraComponent* JobCamera : JobCameras)
+	{
+		const FString CameraName = FPathUtils::GetCameraName(JobCamera);
+		for (const FString& OutputName : Target->OutputNames())
+		{
+			const TRange<int32> OutputMissingRange = RenderManifest.MissingFrameRange(CameraName, OutputName, RenderFrameRange);
+			if (!OutputMissingRange.IsEmpty())
+			{
+				MissingRange = MissingRange.IsEmpty() ? OutputMissingRange : TRange<int32>::Hull(MissingRange, OutputMissingRange);
+			}
+		}
+	}
+	return MissingRange;
+}
+
+void USequenceRenderer::RecordRenderedFrames(const bool bJobFinished)
+{
+	// Output images report the rig camera directory they are written to
+	TMap<FString, FString> CameraDirNames;
+	for (UCameraComponent* RigCamera : RigCameras)
+	{
+		CameraDirNames.Add(
+			FPaths::ConvertRelativePathToFull(FPathUtils::RigCameraDir(RenderingDirectory, RigCamera)),
+			FPathUtils::GetCameraName(RigCamera));
+	}
+	if (RenderManifest.RecordWrittenFrames(CameraDirNames) > 0)
+	{
+		// Counting only walks the in-memory manifest, and only once new frames are written
+		RenderProgress.FramesCompleted = CountRenderedFrames();
+	}
+
+	if (!bJobFinished || !CurrentTarget.IsValid() || RigCameras.Num() == 0)
+	{
+		return;
+	}
+
+	// The pipeline waits for all write tasks of a job before finishing it, so all of its frames are recorded
+	for (int RigCameraId = 0; RigCameraId < RigCameras.Num(); RigCameraId++)
+	{
+		if (CurrentRigCameraId != INDEX_NONE && RigCameraId != CurrentRigCameraId)
+		{
+			continue;
+		}
+		const FString CameraName = FPathUtils::GetCameraName(RigCameras[RigCameraId]);
+		for (const FString& OutputName : CurrentTarget->OutputNames())
+		{
+			if (RenderManifest.MissingFrameRange(CameraName, OutputName, RenderFrameRange).IsEmpty())
+			{
+				RenderManifest.MarkComplete(CameraName, OutputName);
+			}
+		}
+	}
+}
+
+void USequenceRenderer::UpdateProgress()
+{
+	RecordRenderedFrames(false);
+	BroadcastProgress();
+}
+
+void USequenceRenderer::BroadcastProgress()
+{
+	RenderProgress.CameraIndex = FMath::Max(CurrentRigCameraId, 0);
+	RenderProgress.NumCameras = RigCameras.Num();
+	RenderProgress.TargetName = CurrentTarget.IsValid() ? CurrentTarget->Name() : TEXT("");
+	RenderProgress.FramesTotal = RigCameras.Num() * ProgressTargetOutputs.Num() * RenderFrameRange.Size<int32>();
+
+	// Throughput only counts frames rendered by this run
+	const double ElapsedSeconds = FPlatformTime::Seconds() - RenderStartTime;
+	if (ElapsedSeconds > 0.0)
+	{
+		const int32 RunFramesCompleted = RenderProgress.FramesCompleted - InitialFramesCompleted;
+		RenderProgress.FramesPerSecond = RunFramesCompleted / ElapsedSeconds;
+		RenderProgress.MegabytesPerSecond = RenderManifest.NumRecordedBytes() / (1024.0 * 1024.0) / ElapsedSeconds;
+	}
+	RenderProgress.EtaSeconds = (RenderProgress.FramesPerSecond > 0.0f) ?
+		(RenderProgress.FramesTotal - RenderProgress.FramesCompleted) / RenderProgress.FramesPerSecond :
+		-1.0f;
+
+	RenderProgressEvent.Broadcast(RenderProgress);
+	RenderProgressDelegate.Broadcast(RenderProgress);
+}
+
+int32 USequenceRenderer::CountRenderedFrames() const
+{
+	int32 NumFrames = 0;
+	for (UCameraComponent* RigCamera : RigCameras)
+	{
+		const FString CameraName = FPathUtils::GetCameraName(RigCamera);
+		for (const TArray<FString>& OutputNames : ProgressTargetOutputs)
+		{
+			// A frame of a target with multiple outputs is rendered once all of them are written
+			int32 NumTargetFrames = TNumericLimits<int32>::Max();
+			for (const FString& OutputName : OutputNames)
+			{
+				NumTargetFrames = FMath::Min(
+					NumTargetFrames,
+					RenderManifest.NumRenderedFrames(CameraName, OutputName, RenderFrameRange));
+			}
+			NumFrames += NumTargetFrames;
+		}
+	}
+	return NumFrames;
+}
+
+bool USequenceRenderer::PrepareTarget(const TSharedPtr<FRendererTarget>& Target)
+{
+	EASYSYNTH_STAGE_SCOPE(FString::Printf(TEXT("PrepareSequence/%s"), *Target->Name()));
+	return Target->PrepareSequence(RenderingSequence);
+}
+
+bool USequenceRenderer::FinalizeTarget(const TSharedPtr<FRendererTarget>& Target)
+{
+	EASYSYNTH_STAGE_SCOPE(FString::Printf(TEXT("FinalizeSequence/%s"), *Target->Name()));
+	return Target->FinalizeSequence(RenderingSequence);
+}
+
+void USequenceRenderer::StartJobTiming(const TSharedPtr<FRendererTarget>& Target, const int32 NumFrames)
+{
+	TRACE_BOOKMARK(TEXT("EasySynth job started: %s"), *Target->Name());
+	TRACE_COUNTER_INCREMENT(EasySynthRenderJobsStarted);
+	RunningJobTargetName = Target->Name();
+	RunningJobImageFormat = Target->ImageFormat;
+	RunningJobNumFrames = NumFrames;
+	JobStartTime = FPlatformTime::Seconds();
+	JobStartRecordedFiles = RenderManifest.NumRecordedFiles();
+	JobStartRecordedBytes = RenderManifest.NumRecordedBytes();
+}
+
+void USequenceRenderer::FinishJobTiming(const bool bJobSucceeded)
+{
+	if (RunningJobTargetName.IsEmpty())
+	{
+		return;
+	}
+
+	// Files of the job are recorded first, so that its output size is measured from the written files
+	RecordRenderedFrames(false);
+	const double JobSeconds = FPlatformTime::Seconds() - JobStartTime;
+	const int64 JobFiles = RenderManifest.NumRecordedFiles() - JobStartRecordedFiles;
+	const int64 JobBytes = RenderManifest.NumRecordedBytes() - JobStartRecordedBytes;
+
+	TRACE_BOOKMARK(TEXT("EasySynth job finished: %s"), *RunningJobTargetName);
+	FRenderTelemetry::Get().AddSample(
+		FRenderTelemetry::RenderJobStagePrefix + FRenderTelemetry::JobName(RunningJobTargetName, RunningJobImageFormat),
+		JobSeconds,
+		JobBytes,
+		RunningJobNumFrames);
+
+	// Interrupted jobs would distort the frame cost of later estimates
+	if (bJobSucceeded && RunningJobNumFrames > 0)
+	{
+		FRenderTelemetry::AppendHistory(
+			RunningJobTargetName,
+			RunningJobImageFormat,
+			OutputResolution,
+			RunningJobNumFrames,
+			JobSeconds,
+			JobFiles,
+			JobBytes);
+	}
+	RunningJobTargetName.Empty();
+}
+
+bool USequenceRenderer::ExportCameraPoses()
+{
+	EASYSYNTH_STAGE_SCOPE(TEXT("ExportCameraPoses"));
+
+	// The first rig camera renders all rig cameras, taking over their relative transforms when they are selected
+	TArray<FTransform> RenderingCameraTransforms;
+	for (UCameraComponent* RigCamera : RigCameras)
+	{
+		RenderingCameraTransforms.Add(RigCamera->GetRelativeTransform());
+	}
+
+	FCameraPoseExporter CameraPoseExporter;
+	CameraPoseExporter.SetFrameRange(FrameRange);
+	return CameraPoseExporter.ExportCameraPoses(
+		RenderingSequence, OutputResolution, RenderingDirectory, RigCameras, RenderingCameraTransforms);
+}
+
+bool USequenceRenderer::ExportImuSamples()
+{
+	EASYSYNTH_STAGE_SCOPE(TEXT("ExportImuSamples"));
+
+	FCameraPoseExporter CameraPoseExporter;
+	CameraPoseExporter.SetFrameRange(FrameRange);
+	return CameraPoseExporter.ExportImuSamples(
+		RenderingSequence,
+		RenderingDirectory,
+		RendererTargetOptions.ImuRateHz(),
+		RendererTargetOptions.ImuGyroNoise(),
+		RendererTargetOptions.ImuAccelNoise());
+}
+
+bool USequenceRenderer::ExportObjectPoses()
+{
+	EASYSYNTH_STAGE_SCOPE(TEXT("ExportObjectPoses"));
+
+	FObjectPoseExporter ObjectPoseExporter;
+	ObjectPoseExporter.SetFrameRange(FrameRange);
+	return ObjectPoseExporter.ExportObjectPoses(RenderingSequence, RenderingDirectory, TextureStyleManager);
+}
+
+bool USequenceRenderer::ExportBoundingBoxes()
+{
+	EASYSYNTH_STAGE_SCOPE(TEXT("ExportBoundingBoxes"));
+
+	FBoundingBoxExporter BoundingBoxExporter;
+	BoundingBoxExporter.SetFrameRange(FrameRange);
+	return BoundingBoxExporter.ExportBoundingBoxes(
+		RenderingSequence, OutputResolution, RenderingDirectory, RigCameras, TextureStyleManager);
+}
+
+bool USequenceRenderer::ApplyCameraRigOverride()
+{
+	FCameraRigRosInterface CameraRigRosInterface;
+	FCameraRigData CameraRigData;
+	FText LoadErrorMessage;
+	if (!CameraRigRosInterface.LoadCameraRig(CameraRigOverridePath, CameraRigData, LoadErrorMessage))
+	{
+		ErrorMessage = FString::Printf(TEXT("Could not load the camera rig %s: %s"),
+			*CameraRigOverridePath, *LoadErrorMessage.ToString());
+		return false;
+	}
+
+	// Cameras are matched by name, so the rig file has to describe the cameras of the sequence rig
+	for (const FCameraRigData::FCameraData& CameraData : CameraRigData.Cameras)
+	{
+		UCameraComponent** RigCamera = RigCameras.FindByPredicate([&CameraData](UCameraComponent* Camera) {
+			return FPathUtils::GetCameraName(Camera) == CameraData.CameraName;
+		});
+		if (RigCamera == nullptr)
+		{
+			ErrorMessage = FString::Printf(TEXT("Camera %s from the camera rig file not found inside the sequence rig"),
+				*CameraData.CameraName);
+			return false;
+		}
+
+		OverriddenCameras.Add(*RigCamera);
+		OverriddenCameraTransforms.Add((*RigCamera)->GetRelativeTransform());
+		OverriddenCameraFOVs.Add((*RigCamera)->FieldOfView);
+
+		FTransform Transform = CameraData.Transform;
+		Transform.SetScale3D((*RigCamera)->GetRelativeScale3D());
+		(*RigCamera)->SetRelativeTransform(Transform);
+		(*RigCamera)->SetFieldOfView(FCameraRigRosInterface::FieldOfView(CameraData));
+	}
+
+	return true;
+}
+
+void USequenceRenderer::RestoreCameraRigOverride()
+{
+	for (int i = 0; i < OverriddenCameras.Num(); i++)
+	{
+		OverriddenCameras[i]->SetRelativeTransform(OverriddenCameraTransforms[i]);
+		OverriddenCameras[i]->SetFieldOfView(OverriddenCameraFOVs[i]);
+	}
+	OverriddenCameras.Empty();
+	OverriddenCameraTransforms.Empty();
+	OverriddenCameraFOVs.Empty();
+}
+
+bool USequenceRenderer::PrepareJobQueue(UMoviePipelineQueueSubsystem* MoviePipelineQueueSubsystem)
+{
+	check(MoviePipelineQueueSubsystem)
+
+	if (!ConfigurePipeline(EasySynthMoviePipelineConfig, CurrentTarget, CurrentRigCameraId))
+	{
+		return false;
+	}
+
+	// Replace the current queue content with the new job
+	UMoviePipelineQueue* MoviePipelineQueue = ClearJobQueue(MoviePipelineQueueSubsystem);
+	if (MoviePipelineQueue == nullptr)
+	{
+		return false;
+	}
+	return AddJob(MoviePipelineQueue) != nullptr;
+}
+
+bool USequenceRenderer::ConfigurePipeline(
+	UMoviePipelinePrimaryConfig* PipelineConfig,
+	const TSharedPtr<FRendererTarget>& Target,
+	const int RigCameraId)
+{
+	check(PipelineConfig)
+
+	// Update export image format
+	// Engine image outputs are replaced by local ones that report written files to the render manifest
+	for (UClass* EngineOutputClass : {
+		UMoviePipelineImageSequenceOutput_JPG::StaticClass(),
+		UMoviePipelineImageSequenceOutput_PNG::StaticClass() })
+	{
+		if (UMoviePipelineSetting* EngineOutputSetting = PipelineConfig->FindSettingByClass(EngineOutputClass, true))
+		{
+			EngineOutputSetting->SetIsEnabled(false);
+		}
+	}
+	UMoviePipelineSetting* JpegSetting = PipelineConfig->FindOrAddSettingByClass(
+		UMoviePipelineImageSequenceOutput_JPGLocal::StaticClass(), true);
+	UMoviePipelineSetting* PngSetting = PipelineConfig->FindOrAddSettingByClass(
+		UMoviePipelineImageSequenceOutput_PNGLocal::StaticClass(), true);
+	UMoviePipelineSetting* ExrSetting = PipelineConfig->FindOrAddSettingByClass(
+		UMoviePipelineImageSequenceOutput_EXRLocal::StaticClass(), true);
+	UMoviePipelineSetting* ClassIndexSetting = PipelineConfig->FindOrAddSettingByClass(
+		UMoviePipelineImageSequenceOutput_ClassIndex::StaticClass(), true);
+	if (JpegSetting == nullptr || PngSetting == nullptr || ExrSetting == nullptr || ClassIndexSetting == nullptr)
+	{
+		ErrorMessage = "JPEG, PNG, EXR or class index settings not found";
+		return false;
+	}
+	const TArray<FColor> ClassIndexColors = Target->ClassIndexColors();
+	const bool bClassIndices = (ClassIndexColors.Num() > 0);
+	JpegSetting->SetIsEnabled(Target->ImageFormat == EImageFormat::JPEG);
+	PngSetting->SetIsEnabled(Target->ImageFormat == EImageFormat::PNG && !bClassIndices);
+	ExrSetting->SetIsEnabled(Target->ImageFormat == EImageFormat::EXR);
+	ClassIndexSetting->SetIsEnabled(Target->ImageFormat == EImageFormat::PNG && bClassIndices);
+	Cast<UMoviePipelineImageSequenceOutput_ClassIndex>(ClassIndexSetting)->ClassColors = ClassIndexColors;
+
+	// The rig rendering renders a view of each frame for every bound rig camera, instead of the camera cut camera
+	UMoviePipelineCameraSetting* CameraSetting = Cast<UMoviePipelineCameraSetting>(
+		PipelineConfig->FindOrAddSettingByClass(UMoviePipelineCameraSetting::StaticClass(), true));
+	if (CameraSetting == nullptr)
+	{
+		ErrorMessage = "Could not find the camera setting inside the default config";
+		return false;
+	}
+	CameraSetting->bRenderAllCameras = (RigCameraId == INDEX_NONE);
+
+	// Update pipeline output settings for the target
+	UMoviePipelineOutputSetting* OutputSetting = PipelineConfig->FindSetting<UMoviePipelineOutputSetting>();
+	if (OutputSetting == nullptr)
+	{
+		ErrorMessage = "Could not find the output setting inside the default config";
+		return false;
+	}
+	OutputSetting->OutputResolution = OutputResolution;
+
+	// Restrict the rendering to the requested frame range, or to frames missing from the previous run
+	const TRange<int32> JobRange = JobFrameRange(Target, RigCameraId);
+	OutputSetting->bUseCustomPlaybackRange = (JobRange != FSequencerWrapper::PlaybackFrameRange(RenderingSequence));
+	if (OutputSetting->bUseCustomPlaybackRange)
+	{
+		OutputSetting->CustomStartFrame = JobRange.GetLowerBoundValue();
+		OutputSetting->CustomEndFrame = JobRange.GetUpperBoundValue();
+	}
+
+	// Get the deferred rendering setting that renders the main and additional render passes
+	UMoviePipelineDeferredPassBase* DeferredPassSetting = PipelineConfig->FindSetting<UMoviePipelineDeferredPassBase>();
+	if (DeferredPassSetting == nullptr)
+	{
+		ErrorMessage = "Could not find the deferred rendering setting inside the default config";
+		return false;
+	}
+	DeferredPassSetting->AdditionalPostProcessMaterials.Empty();
+
+	// Views of the rig cameras are routed into their directories by the names of their bindings
+	const FString RigCameraDir = (RigCameraId == INDEX_NONE) ?
+		RenderingDirectory / TEXT("{camera_name}") :
+		FPathUtils::RigCameraDir(RenderingDirectory, RigCameras[RigCameraId]);
+	const TArray<UMaterialInterface*> RenderPassMaterials = Target->RenderPassMaterials();
+	UMoviePipelineImageSequenceOutput_EXRLocal* ExrOutputSetting = Cast<UMoviePipelineImageSequenceOutput_EXRLocal>(ExrSetting);
+	ExrOutputSetting->RawOutput = Target->RawOutput();
+	ExrOutputSetting->bNameAllLayers = false;
+	if (Target->RawOutput() != ERawImageOutput::None)
+	{
+		if (RenderPassMaterials.Num() != 1)
+		{
+			ErrorMessage = FString::Printf(TEXT("Could not get the render pass material of the %s target"), *Target->Name());
+			return false;
+		}
+
+		// The single render pass is converted into raw values by the EXR output
+		DeferredPassSetting->bRenderMainPass = false;
+		FMoviePipelinePostProcessPass RenderPass;
+		RenderPass.bEnabled = true;
+		RenderPass.Material = RenderPassMaterials[0];
+		RenderPass.bHighPrecisionOutput = true;
+		DeferredPassSetting->AdditionalPostProcessMaterials.Add(RenderPass);
+		OutputSetting->OutputDirectory.Path = RigCameraDir / Target->Name();
+		OutputSetting->FileNameFormat = DefaultFileNameFormat;
+		ExrOutputSetting->bMultilayer = true;
+	}
+	else if (RenderPassMaterials.Num() == 0)
+	{
+		// The target is applied through the camera post process and output by the main render pass
+		DeferredPassSetting->bRenderMainPass = true;
+		OutputSetting->OutputDirectory.Path = RigCameraDir / Target->Name();
+		OutputSetting->FileNameFormat = DefaultFileNameFormat;
+		ExrOutputSetting->bMultilayer = bDefaultExrMultilayer;
+	}
+	else
+	{
+		// Each target is output by its own render pass, named after the target,
+		// so the render pass name is used to route images into target directories
+		DeferredPassSetting->bRenderMainPass = false;
+		for (UMaterialInterface* RenderPassMaterial : RenderPassMaterials)
+		{
+			FMoviePipelinePostProcessPass RenderPass;
+			RenderPass.bEnabled = true;
+			RenderPass.Material = RenderPassMaterial;
+			RenderPass.bHighPrecisionOutput = (Target->ImageFormat == EImageFormat::EXR);
+			DeferredPassSetting->AdditionalPostProcessMaterials.Add(RenderPass);
+		}
+		if (Target->ImageFormat == EImageFormat::EXR && RendererTargetOptions.MultilayerExr())
+		{
+			// All render passes are written as named layers of a single file per frame
+			OutputSetting->OutputDirectory.Path = RigCameraDir / Target->Name();
+			OutputSetting->FileNameFormat = DefaultFileNameFormat;
+			ExrOutputSetting->bMultilayer = true;
+			ExrOutputSetting->bNameAllLayers = true;
+		}
+		else
+		{
+			OutputSetting->OutputDirectory.Path = RigCameraDir;
+			OutputSetting->FileNameFormat = TEXT("{render_pass}") / DefaultFileNameFormat;
+			// Multilayer EXR files would merge all render passes into a single file
+			ExrOutputSetting->bMultilayer = false;
+		}
+	}
+
+	return true;
+}
+
+UMoviePipelineQueue* USequenceRenderer::ClearJobQueue(UMoviePipelineQueueSubsystem* MoviePipelineQueueSubsystem)
+{
+	check(MoviePipelineQueueSubsystem)
+
+	// Get the queue of sequences to be renderer
+	UMoviePipelineQueue* MoviePipelineQueue = MoviePipelineQueueSubsystem->GetQueue();
+	if (MoviePipelineQueue == nullptr)
+	{
+		ErrorMessage = "Could not get the UMoviePipelineQueue";
+		return nullptr;
+	}
+	MoviePipelineQueue->Modify();
+
+	// Clear the current queue
+	TArray<UMoviePipelineExecutorJob*> ExistingJobs = MoviePipelineQueue->GetJobs();
+	for (UMoviePipelineExecutorJob* MoviePipelineExecutorJob : ExistingJobs)
 	{
 		MoviePipelineQueue->DeleteJob(MoviePipelineExecutorJob);
 	}
 	if (MoviePipelineQueue->GetJobs().Num() > 0)
 	{
 		ErrorMessage = "Job queue not properly cleared";
-		return false;
+		return nullptr;
 	}
 
+	return MoviePipelineQueue;
+}
+
+UMoviePipelineExecutorJob* USequenceRenderer::AddJob(UMoviePipelineQueue* MoviePipelineQueue)
+{
+	check(MoviePipelineQueue)
+
 	// Add received level sequence to the queue as a new job
 	UMoviePipelineExecutorJob* NewJob = MoviePipelineQueue->AllocateNewJob(UMoviePipelineExecutorJob::StaticClass());
 	if (NewJob == nullptr)
 	{
 		ErrorMessage = "Failed to create new rendering job";
-		return false;
+		return nullptr;
 	}
 	NewJob->Modify();
 	NewJob->Map = FSoftObjectPath(GEditor->GetEditorWorldContext().World());
@@ -502,11 +1472,103 @@ bool USequenceRenderer::PrepareJobQueue(UMoviePipelineQueueSubsystem* MoviePipel
 	// The SetConfiguration method creates and assigns the copy of the provided config
 	NewJob->SetConfiguration(EasySynthMoviePipelineConfig);
 
+	return NewJob;
+}
+
+bool USequenceRenderer::RunJobQueue(UMoviePipelineQueueSubsystem* MoviePipelineQueueSubsystem)
+{
+	check(MoviePipelineQueueSubsystem)
+
+	// Get the default movie rendering settings
+	const UMovieRenderPipelineProjectSettings* ProjectSettings = GetDefault<UMovieRenderPipelineProjectSettings>();
+	if (ProjectSettings->DefaultLocalExecutor == nullptr)
+	{
+		ErrorMessage = "Could not get the UMovieRenderPipelineProjectSettings";
+		return false;
+	}
+
+	// Create the executor, so that callbacks are assigned before any of the jobs starts
+	ActiveExecutor = NewObject<UMoviePipelineExecutorBase>(
+		GetTransientPackage(), ProjectSettings->DefaultLocalExecutor.ResolveClass());
+	if (ActiveExecutor == nullptr)
+	{
+		ErrorMessage = "Could not start the rendering";
+		return false;
+	}
+	ActiveExecutor->OnExecutorFinished().AddUObject(this, &USequenceRenderer::OnExecutorFinished);
+	ActiveExecutor->OnIndividualJobStarted().AddUObject(this, &USequenceRenderer::OnIndividualJobStarted);
+
+	// Run the rendering
+	MoviePipelineQueueSubsystem->RenderQueueWithExecutorInstance(ActiveExecutor);
+
+	return true;
+}
+
+bool USequenceRenderer::StartDatasetShards()
+{
+	const int64 MaxShardBytes = int64(RendererTargetOptions.DatasetShardSizeMegabytes()) * 1024 * 1024;
+	DatasetShardPacker = MakeShared<FDatasetShardPacker>(FPathUtils::DatasetShardsDir(RenderingDirectory), MaxShardBytes);
+	DatasetShardPacker->Open(RendererTargetOptions.ResumeRendering());
+
+	// Camera pose rows belong to the frames covered by camera cut sections inside the requested range,
+	// collected the same way as by the camera pose export, so that rows are found by their frame numbers
+	FSequenceFrameEvaluator::FFrames PoseFrames;
+	if (RendererTargetOptions.ExportCameraPoses())
+	{
+		FSequencerWrapper SequencerWrapper;
+		if (!SequencerWrapper.OpenSequence(RenderingSequence))
+		{
+			UE_LOG(LogEasySynth, Error, TEXT("%s: Sequencer wrapper opening failed"), *FString(__FUNCTION__))
+			DatasetShardPacker.Reset();
+			return false;
+		}
+		FSequenceFrameEvaluator::CollectFrameTicks(SequencerWrapper, FrameRange, PoseFrames);
+	}
+
+	for (UCameraComponent* RigCamera : RigCameras)
+	{
+		const FString PosesFilePath = RendererTargetOptions.ExportCameraPoses() ?
+			FPathUtils::CameraPosesFilePath(RenderingDirectory, RigCamera) :
+			FString();
+		if (!DatasetShardPacker->AddCamera(
+			FPathUtils::RigCameraDir(RenderingDirectory, RigCamera),
+			FPathUtils::GetCameraName(RigCamera),
+			PosesFilePath,
+			PoseFrames.FrameNumbers))
+		{
+			DatasetShardPacker.Reset();
+			return false;
+		}
+	}
+
 	return true;
 }
 
-void USequenceRenderer::BroadcastRenderingFinished(const bool bSuccess)
+bool USequenceRenderer::FinishDatasetShards()
+{
+	if (!DatasetShardPacker.IsValid())
+	{
+		return true;
+	}
+
+	EASYSYNTH_STAGE_SCOPE(TEXT("FinishDatasetShards"));
+
+	// The pipeline waits for all write tasks of a job, so no images are on their way to the packer
+	FDatasetShardPacker::SetActive(nullptr);
+	const bool bClosed = DatasetShardPacker->Close();
+	DatasetShardPacker.Reset();
+	return bClosed;
+}
+
+void USequenceRenderer::BroadcastRenderingFinished(bool bSuccess)
 {
+	// Shards are finished regardless of the rendering result, so that samples packed so far stay readable
+	if (!FinishDatasetShards() && bSuccess)
+	{
+		ErrorMessage = "Could not finish the dataset shards";
+		bSuccess = false;
+	}
+
 	if (!bSuccess)
 	{
 		UE_LOG(LogEasySynth, Warning, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
@@ -518,13 +1580,171 @@ void USequenceRenderer::BroadcastRenderingFinished(const bool bSuccess)
 		RigCameras[0]->SetRelativeTransform(OriginalCameraTransform);
 		RigCameras[0]->SetFieldOfView(OriginalCameraFOV);
 	}
+	RestoreCameraRigOverride();
+	UnbindRigCameras();
 
+	ReadinessScheduler.Cancel();
+	GEditor->GetEditorWorldContext().World()->GetTimerManager().ClearTimer(ProgressTimerHandle);
+	const bool bJobSucceeded = false;
+	FinishJobTiming(bJobSucceeded);
 	RigCameras.Empty();
 	TargetsQueue.Empty();
+	CurrentTarget = nullptr;
 
 	// Revert world state to the original one
 	TextureStyleManager->CheckoutTextureStyle(OriginalTextureStyle);
 
+	// Export stage timings, including failed runs, as they tell where the time went before the failure
+	FRenderTelemetry::Get().AddSample(TEXT("Run"), FPlatformTime::Seconds() - RenderStartTime);
+	FRenderTelemetry::Get().ExportTimings(RenderingDirectory);
+
 	bCurrentlyRendering = false;
 	RenderingFinishedEvent.Broadcast(bSuccess);
+
+	// Proceed with the render queue regardless of the sequence rendering result
+	if (CurrentQueueEntryId != INDEX_NONE)
+	{
+		FinishQueueEntry(bSuccess);
+	}
+}
+
+void USequenceRenderer::RenderNextQueueEntry()
+{
+	CurrentQueueEntryId = RenderQueue.jobs.IndexOfByPredicate([](const FRenderQueueEntry& Entry) {
+		return Entry.status == FRenderQueueEntry::StatusPending;
+	});
+
+	// Check if the end is reached
+	if (CurrentQueueEntryId == INDEX_NONE)
+	{
+		UE_LOG(LogEasySynth, Log, TEXT("%s: Render queue finished with %d failed sequences"),
+			*FString(__FUNCTION__), NumFailedQueueEntries)
+		bProcessingQueue = false;
+		QueueFinishedEvent.Broadcast(NumFailedQueueEntries);
+		return;
+	}
+
+	// Mark the entry before rendering, so that a crash leaves a trace inside the queue file
+	FRenderQueueEntry& Entry = RenderQueue.jobs[CurrentQueueEntryId];
+	Entry.status = FRenderQueueEntry::StatusRendering;
+	Entry.error = "";
+	SaveRenderQueue();
+
+	UE_LOG(LogEasySynth, Log, TEXT("%s: Rendering queue entry %d/%d"),
+		*FString(__FUNCTION__), CurrentQueueEntryId + 1, RenderQueue.jobs.Num())
+
+	// Rendering that fails to start does not broadcast the finished event, so the entry is finished here
+	if (!StartQueueEntry(Entry.job))
+	{
+		FinishQueueEntry(false);
+	}
+}
+
+bool USequenceRenderer::StartQueueEntry(const FRenderJobSpec& Job)
+{
+	// Entries of different maps can share a queue, so the map of the entry is loaded if another one is open
+	const FString LoadedMap = GEditor->GetEditorWorldContext().World()->GetOutermost()->GetName();
+	if (!Job.map.IsEmpty() && Job.map != LoadedMap)
+	{
+		UE_LOG(LogEasySynth, Log, TEXT("%s: Loading the map %s"), *FString(__FUNCTION__), *Job.map)
+		if (UEditorLoadingAndSavingUtils::LoadMap(Job.map) == nullptr)
+		{
+			ErrorMessage = FString::Printf(TEXT("Could not load the map %s"), *Job.map);
+			return false;
+		}
+	}
+
+	if (Job.level_sequences.Num() != 1 || Job.resolution.Num() != 2)
+	{
+		ErrorMessage = "Invalid render queue entry";
+		return false;
+	}
+
+	ULevelSequence* LevelSequence = LoadObject<ULevelSequence>(nullptr, *Job.level_sequences[0]);
+	if (LevelSequence == nullptr)
+	{
+		ErrorMessage = FString::Printf(TEXT("Could not load the level sequence %s"), *Job.level_sequences[0]);
+		return false;
+	}
+
+	FRendererTargetOptions TargetOptions;
+	if (!Job.GetRendererTargetOptions(TargetOptions))
+	{
+		ErrorMessage = "Invalid rendering options";
+		return false;
+	}
+
+	SetCameraRigOverride(Job.camera_rig);
+	return RenderSequence(
+		FAssetData(LevelSequence),
+		TargetOptions,
+		FIntPoint(Job.resolution[0], Job.resolution[1]),
+		Job.output_dir);
+}
+
+void USequenceRenderer::FinishQueueEntry(const bool bSuccess)
+{
+	FRenderQueueEntry& Entry = RenderQueue.jobs[CurrentQueueEntryId];
+	Entry.status = bSuccess ? FRenderQueueEntry::StatusDone : FRenderQueueEntry::StatusFailed;
+	if (!bSuccess)
+	{
+		Entry.error = ErrorMessage;
+		NumFailedQueueEntries++;
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: Rendering %s failed, proceeding with the next sequence"),
+			*FString(__FUNCTION__), *Entry.job.level_sequences[0])
+	}
+	SaveRenderQueue();
+	CurrentQueueEntryId = INDEX_NONE;
+
+	// Start the next entry once the rendering finished event handlers are done
+	GEditor->GetEditorWorldContext().World()->GetTimerManager().SetTimerForNextTick(
+		FTimerDelegate::CreateUObject(this, &USequenceRenderer::RenderNextQueueEntry));
+}
+
+bool USequenceRenderer::LoadRenderQueue()
+{
+	RenderQueue.jobs.Empty();
+
+	// A missing file means there is no queue left from previous sessions
+	FString FileContent;
+	if (!FFileHelper::LoadFileToString(FileContent, *RenderQueueFilePath))
+	{
+		return true;
+	}
+
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct(FileContent, &RenderQueue, 0, 0))
+	{
+		ErrorMessage = FString::Printf(TEXT("Invalid render queue file %s"), *RenderQueueFilePath);
+		return false;
+	}
+
+	// Finished entries belong to previous batches, while entries interrupted by a crash are rendered again
+	RenderQueue.jobs.RemoveAll([](const FRenderQueueEntry& Entry) {
+		return Entry.status == FRenderQueueEntry::StatusDone || Entry.status == FRenderQueueEntry::StatusFailed;
+	});
+	for (FRenderQueueEntry& Entry : RenderQueue.jobs)
+	{
+		Entry.status = FRenderQueueEntry::StatusPending;
+	}
+
+	if (RenderQueue.jobs.Num() > 0)
+	{
+		UE_LOG(LogEasySynth, Log, TEXT("%s: Continuing %d sequences left inside the render queue"),
+			*FString(__FUNCTION__), RenderQueue.jobs.Num())
+	}
+
+	return true;
+}
+
+bool USequenceRenderer::SaveRenderQueue()
+{
+	FString JsonString;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(RenderQueue, JsonString) ||
+		!FFileHelper::SaveStringToFile(JsonString, *RenderQueueFilePath))
+	{
+		ErrorMessage = FString::Printf(TEXT("Failed while saving the render queue file %s"), *RenderQueueFilePath);
+		UE_LOG(LogEasySynth, Warning, TEXT("%s: %s"), *FString(__FUNCTION__), *ErrorMessage)
+		return false;
+	}
+	return true;
 }
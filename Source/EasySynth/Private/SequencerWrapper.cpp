@@ -6,6 +6,7 @@
 #include "ISequencer.h"
 #include "LevelSequence.h"
 #include "MovieScene.h"
+#include "MovieSceneTimeHelpers.h"
 #include "Sections/MovieSceneCameraCutSection.h"
 #include "Subsystems/AssetEditorSubsystem.h"
 
@@ -98,3 +99,73 @@ TArray<UMovieSceneCameraCutSection*>& FSequencerWrapper::GetMovieSceneCutSection
 
 	return MovieSceneCutSections;
 }
+
+TRange<int32> FSequencerWrapper::PlaybackFrameRange(ULevelSequence* LevelSequence)
+{
+	UMovieScene* LevelSequenceMovieScene = LevelSequence->GetMovieScene();
+	if (LevelSequenceMovieScene == nullptr)
+	{
+		return TRange<int32>::Empty();
+	}
+
+	// Display frames are used by the movie pipeline
+	return TicksToDisplayFrames(LevelSequenceMovieScene, LevelSequenceMovieScene->GetPlaybackRange());
+}
+
+int32 FSequencerWrapper::CutSectionFrameCount(const TRange<int32>& FrameRange)
+{
+	TRange<int32> CountedRange = TicksToDisplayFrames(GetMovieScene(), GetMovieScene()->GetPlaybackRange());
+	if (FrameRange.HasLowerBound() && FrameRange.HasUpperBound())
+	{
+		CountedRange = TRange<int32>::Intersection(CountedRange, FrameRange);
+	}
+	if (CountedRange.IsEmpty())
+	{
+		return 0;
+	}
+
+	// Cut sections may overlap or leave gaps, so count each covered frame only once
+	TSet<int32> CoveredFrames;
+	for (UMovieSceneCameraCutSection* CutSection : MovieSceneCutSections)
+	{
+		// Open section bounds extend to the playback range bounds
+		const TRange<FFrameNumber> SectionTicks = TRange<FFrameNumber>::Intersection(
+			CutSection->GetRange(), GetMovieScene()->GetPlaybackRange());
+		const TRange<int32> SectionFrames = TRange<int32>::Intersection(
+			TicksToDisplayFrames(GetMovieScene(), SectionTicks), CountedRange);
+		if (SectionFrames.IsEmpty())
+		{
+			continue;
+		}
+
+		for (int32 Frame = SectionFrames.GetLowerBoundValue(); Frame < SectionFrames.GetUpperBoundValue(); Frame++)
+		{
+			CoveredFrames.Add(Frame);
+		}
+	}
+
+	return CoveredFrames.Num();
+}
+
+TRange<int32> FSequencerWrapper::TicksToDisplayFrames(
+	UMovieScene* LevelSequenceMovieScene,
+	const TRange<FFrameNumber>& TickRange)
+{
+	if (TickRange.IsEmpty() || !TickRange.HasLowerBound() || !TickRange.HasUpperBound())
+	{
+		return TRange<int32>::Empty();
+	}
+
+	const FFrameRate DisplayRate = LevelSequenceMovieScene->GetDisplayRate();
+	const FFrameRate TickResolution = LevelSequenceMovieScene->GetTickResolution();
+	const int32 StartFrame = FFrameRate::TransformTime(
+		FFrameTime(UE::MovieScene::DiscreteInclusiveLower(TickRange)), TickResolution, DisplayRate).FloorToFrame().Value;
+	const int32 EndFrame = FFrameRate::TransformTime(
+		FFrameTime(UE::MovieScene::DiscreteExclusiveUpper(TickRange)), TickResolution, DisplayRate).CeilToFrame().Value;
+	if (EndFrame <= StartFrame)
+	{
+		return TRange<int32>::Empty();
+	}
+
+	return TRange<int32>(StartFrame, EndFrame);
+}
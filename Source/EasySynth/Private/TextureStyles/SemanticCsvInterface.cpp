@@ -6,6 +6,7 @@
 #include "IDesktopPlatform.h"
 #include "Serialization/Csv/CsvParser.h"
 
+#include "ClassIndexOutput/MoviePipelineClassIndexOutput.h"
 #include "EasySynth.h"
 #include "TextureStyles/TextureMappingAsset.h"
 #include "TextureStyles/TextureStyleManager.h"
@@ -116,4 +117,39 @@ bool FSemanticCsvInterface::ExportSemanticClasses(const FString& OutputDir, UTex
 	return true;
 }
 
+bool FSemanticCsvInterface::ExportSemanticClassIndices(const FString& OutputDir, UTextureMappingAsset* TextureMappingAsset)
+{
+	TArray<FString> Lines;
+	Lines.Add(TEXT("index,name,r,g,b"));
+
+	// Classes are indexed in the same order they are exported in
+	int ClassIndex = 0;
+	for (auto Element : TextureMappingAsset->SemanticClasses)
+	{
+		const FSemanticClass& Class = Element.Value;
+		Lines.Add(FString::Printf(TEXT("%d,%s,%d,%d,%d"),
+			ClassIndex, *Class.Name, Class.Color.R, Class.Color.G, Class.Color.B));
+		ClassIndex++;
+	}
+
+	// Pixels matching none of the class colors get the index following the last class, which has no color
+	Lines.Add(FString::Printf(TEXT("%d,%s,,,"),
+		FClassIndexImageWriteTask::UnknownClassIndex(ClassIndex), *FClassIndexImageWriteTask::UnknownClassName));
+
+	// Save the file
+	const FString SaveFilePath = FPathUtils::SemanticClassIndicesFilePath(OutputDir);
+	if (!FFileHelper::SaveStringArrayToFile(
+		Lines,
+		*SaveFilePath,
+		FFileHelper::EEncodingOptions::AutoDetect,
+		&IFileManager::Get(),
+		EFileWrite::FILEWRITE_None))
+	{
+		UE_LOG(LogEasySynth, Error, TEXT("%s: Failed while saving the file %s"), *FString(__FUNCTION__), *SaveFilePath)
+		return false;
+	}
+
+	return true;
+}
+
 #undef LOCTEXT_NAMESPACE
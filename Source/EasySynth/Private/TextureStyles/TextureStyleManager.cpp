@@ -13,6 +13,7 @@
 
 #include "EasySynth.h"
 #include "PathUtils.h"
+#include "RenderTelemetry.h"
 #include "TextureStyles/TextureBackupManager.h"
 #include "TextureStyles/TextureMappingAsset.h"
 
@@ -267,6 +268,12 @@ TArray<FString> UTextureStyleManager::SemanticClassNames() const
 	return SemanticClassNames;
 }
 
+FString UTextureStyleManager::ActorClassName(const FGuid& ActorGuid) const
+{
+	const FString* ClassName = TextureMappingAsset->ActorClassPairs.Find(ActorGuid);
+	return (ClassName != nullptr) ? *ClassName : FString();
+}
+
 TArray<const FSemanticClass*> UTextureStyleManager::SemanticClasses() const
 {
 	TArray<const FSemanticClass*> SemanticClasses;
@@ -319,6 +326,8 @@ void UTextureStyleManager::CheckoutTextureStyle(const ETextureStyle NewTextureSt
 		return;
 	}
 
+	EASYSYNTH_STAGE_SCOPE(TEXT("CheckoutTextureStyle"));
+
 	// Apply materials to all actors
 	TArray<AActor*> LevelActors;
 	UGameplayStatics::GetAllActorsOfClass(GEditor->GetEditorWorldContext().World(), AActor::StaticClass(), LevelActors);
@@ -339,6 +348,30 @@ bool UTextureStyleManager::ExportSemanticClasses(const FString& OutputDir)
 	return SemanticCsvInterface.ExportSemanticClasses(OutputDir, TextureMappingAsset);
 }
 
+bool UTextureStyleManager::ExportSemanticClassIndices(const FString& OutputDir)
+{
+	FSemanticCsvInterface SemanticCsvInterface;
+	return SemanticCsvInterface.ExportSemanticClassIndices(OutputDir, TextureMappingAsset);
+}
+
+UMaterial* UTextureStyleManager::PostProcessMaterial(const FString& TargetName)
+{
+	UMaterial** CachedMaterial = PostProcessMaterials.Find(TargetName);
+	if (CachedMaterial != nullptr && *CachedMaterial != nullptr)
+	{
+		return *CachedMaterial;
+	}
+
+	// Duplicating the material triggers its shader compilation, so it is done only once per target
+	UMaterial* Material = DuplicateObject<UMaterial>(
+		LoadObject<UMaterial>(nullptr, *FPathUtils::PostProcessMaterialPath(TargetName)), nullptr);
+	if (Material != nullptr)
+	{
+		PostProcessMaterials.Add(TargetName, Material);
+	}
+	return Material;
+}
+
 void UTextureStyleManager::LoadOrCreateTextureMappingAsset()
 {
 	// Try to load
@@ -38,7 +38,8 @@ FWidgetManager::FWidgetManager() :
 	TextureStyleManager->OnSemanticClassesUpdated().AddRaw(this, &FWidgetManager::OnSemanticClassesUpdated);
 
 	// Create the sequence renderer and add it to the root to avoid garbage collection
-	SequenceRenderer = NewObject<USequenceRenderer>();
+	// The renderer is named, so scripts can find it to follow the rendering progress
+	SequenceRenderer = NewObject<USequenceRenderer>(GetTransientPackage(), USequenceRenderer::EditorRendererName);
 	check(SequenceRenderer)
 	SequenceRenderer->AddToRoot();
 	// Register the rendering finished callback
@@ -236,6 +237,42 @@ TSharedRef<SDockTab> FWidgetManager::OnSpawnPluginTab(const FSpawnTabArgs& Spawn
 				]
 			]
 			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(SCheckBox)
+				.IsChecked_Lambda(
+					[this]()
+					{
+						const bool bChecked = SequenceRendererTargets.ExportObjectPoses();
+						return bChecked ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+					})
+				.OnCheckStateChanged_Lambda(
+					[this](ECheckBoxState NewState)
+					{ SequenceRendererTargets.SetExportObjectPoses(NewState == ECheckBoxState::Checked); })
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("ObjectPosesCheckBoxText", "Object poses"))
+				]
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(SCheckBox)
+				.IsChecked_Lambda(
+					[this]()
+					{
+						const bool bChecked = SequenceRendererTargets.ExportBoundingBoxes();
+						return bChecked ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+					})
+				.OnCheckStateChanged_Lambda(
+					[this](ECheckBoxState NewState)
+					{ SequenceRendererTargets.SetExportBoundingBoxes(NewState == ECheckBoxState::Checked); })
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("BoundingBoxesCheckBoxText", "Bounding boxes"))
+				]
+			]
+			+SScrollBox::Slot()
 			[
 				TargetsScrollBoxes
 			]
@@ -277,6 +314,78 @@ TSharedRef<SDockTab> FWidgetManager::OnSpawnPluginTab(const FSpawnTabArgs& Spawn
 			]
 			+SScrollBox::Slot()
 			.Padding(2)
+			[
+				SNew(SCheckBox)
+				.IsChecked_Lambda(
+					[this]()
+					{
+						const bool bChecked = SequenceRendererTargets.SinglePassRendering();
+						return bChecked ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+					})
+				.OnCheckStateChanged_Lambda(
+					[this](ECheckBoxState NewState)
+					{ SequenceRendererTargets.SetSinglePassRendering(NewState == ECheckBoxState::Checked); })
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("SinglePassRenderingCheckBoxText", "Render compatible targets in a single pass"))
+				]
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(SCheckBox)
+				.IsChecked_Lambda(
+					[this]()
+					{
+						const bool bChecked = SequenceRendererTargets.MultilayerExr();
+						return bChecked ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+					})
+				.OnCheckStateChanged_Lambda(
+					[this](ECheckBoxState NewState)
+					{ SequenceRendererTargets.SetMultilayerExr(NewState == ECheckBoxState::Checked); })
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("MultilayerExrCheckBoxText", "Write EXR targets as layers of a single file"))
+				]
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(SCheckBox)
+				.IsChecked_Lambda(
+					[this]()
+					{
+						const bool bChecked = SequenceRendererTargets.ParallelRigRendering();
+						return bChecked ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+					})
+				.OnCheckStateChanged_Lambda(
+					[this](ECheckBoxState NewState)
+					{ SequenceRendererTargets.SetParallelRigRendering(NewState == ECheckBoxState::Checked); })
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("ParallelRigRenderingCheckBoxText", "Render all rig cameras in a single run"))
+				]
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(SCheckBox)
+				.IsChecked_Lambda(
+					[this]()
+					{
+						const bool bChecked = SequenceRendererTargets.ResumeRendering();
+						return bChecked ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+					})
+				.OnCheckStateChanged_Lambda(
+					[this](ECheckBoxState NewState)
+					{ SequenceRendererTargets.SetResumeRendering(NewState == ECheckBoxState::Checked); })
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("ResumeRenderingCheckBoxText", "Resume the interrupted rendering"))
+				]
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
 			[
 				SNew(STextBlock)
 				.Text(LOCTEXT("OutputWidthText", "Output image width [px]"))
@@ -335,6 +444,24 @@ TSharedRef<SDockTab> FWidgetManager::OnSpawnPluginTab(const FSpawnTabArgs& Spawn
 			]
 			+SScrollBox::Slot()
 			.Padding(2)
+			[
+				SNew(SCheckBox)
+				.IsChecked_Lambda(
+					[this]()
+					{
+						const bool bChecked = SequenceRendererTargets.DepthInMeters();
+						return bChecked ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+					})
+				.OnCheckStateChanged_Lambda(
+					[this](ECheckBoxState NewState)
+					{ SequenceRendererTargets.SetDepthInMeters(NewState == ECheckBoxState::Checked); })
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("DepthInMetersCheckBoxText", "Write depth in meters (EXR only)"))
+				]
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
 			[
 				SNew(STextBlock)
 				.Text(LOCTEXT("OpticalFlowScaleText", "Optical flow scale coefficient"))
@@ -351,6 +478,122 @@ TSharedRef<SDockTab> FWidgetManager::OnSpawnPluginTab(const FSpawnTabArgs& Spawn
 			]
 			+SScrollBox::Slot()
 			.Padding(2)
+			[
+				SNew(SCheckBox)
+				.IsChecked_Lambda(
+					[this]()
+					{
+						const bool bChecked = SequenceRendererTargets.OpticalFlowInPixels();
+						return bChecked ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+					})
+				.OnCheckStateChanged_Lambda(
+					[this](ECheckBoxState NewState)
+					{ SequenceRendererTargets.SetOpticalFlowInPixels(NewState == ECheckBoxState::Checked); })
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("OpticalFlowInPixelsCheckBoxText", "Write optical flow in pixels (EXR only)"))
+				]
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(SCheckBox)
+				.IsChecked_Lambda(
+					[this]()
+					{
+						const bool bChecked = SequenceRendererTargets.SemanticClassIndices();
+						return bChecked ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+					})
+				.OnCheckStateChanged_Lambda(
+					[this](ECheckBoxState NewState)
+					{ SequenceRendererTargets.SetSemanticClassIndices(NewState == ECheckBoxState::Checked); })
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("SemanticClassIndicesCheckBoxText", "Write semantic class indices (PNG only)"))
+				]
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("ReadinessTimeoutText", "Maximum wait before each render [s]"))
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(SSpinBox<float>)
+				.Value_Lambda([this](){ return SequenceRendererTargets.ReadinessTimeout(); })
+				.OnValueChanged_Lambda(
+					[this](const float NewValue){ SequenceRendererTargets.SetReadinessTimeout(NewValue); })
+				.MinValue(0.0f)
+				.MaxValue(600.0f)
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("DatasetShardSizeText", "Dataset shard size [MB], 0 keeps separate image files"))
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(SSpinBox<int32>)
+				.Value_Lambda([this](){ return SequenceRendererTargets.DatasetShardSizeMegabytes(); })
+				.OnValueChanged_Lambda(
+					[this](const int32 NewValue){ SequenceRendererTargets.SetDatasetShardSizeMegabytes(NewValue); })
+				.MinValue(0)
+				.MaxValue(65536)
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("ImuRateText", "IMU sample rate [Hz], 0 disables the IMU export"))
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(SSpinBox<float>)
+				.Value_Lambda([this](){ return SequenceRendererTargets.ImuRateHz(); })
+				.OnValueChanged_Lambda(
+					[this](const float NewValue){ SequenceRendererTargets.SetImuRateHz(NewValue); })
+				.MinValue(0.0f)
+				.MaxValue(10000.0f)
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("ImuGyroNoiseText", "IMU gyroscope noise [rad/s]"))
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(SSpinBox<float>)
+				.Value_Lambda([this](){ return SequenceRendererTargets.ImuGyroNoise(); })
+				.OnValueChanged_Lambda(
+					[this](const float NewValue){ SequenceRendererTargets.SetImuGyroNoise(NewValue); })
+				.MinValue(0.0f)
+				.MaxValue(10.0f)
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(STextBlock)
+				.Text(LOCTEXT("ImuAccelNoiseText", "IMU accelerometer noise [m/s^2]"))
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(SSpinBox<float>)
+				.Value_Lambda([this](){ return SequenceRendererTargets.ImuAccelNoise(); })
+				.OnValueChanged_Lambda(
+					[this](const float NewValue){ SequenceRendererTargets.SetImuAccelNoise(NewValue); })
+				.MinValue(0.0f)
+				.MaxValue(100.0f)
+			]
+			+SScrollBox::Slot()
+			.Padding(2)
 			[
 				SNew(STextBlock)
 				.Text(LOCTEXT("OuputDirectoryText", "Ouput directory"))
@@ -374,6 +617,18 @@ TSharedRef<SDockTab> FWidgetManager::OnSpawnPluginTab(const FSpawnTabArgs& Spawn
 					.Text(LOCTEXT("RenderImagesButtonText", "Render Images"))
 				]
 			]
+			+SScrollBox::Slot()
+			.Padding(2)
+			[
+				SNew(SButton)
+				.IsEnabled_Raw(this, &FWidgetManager::GetIsRenderImagesEnabled)
+				.OnClicked_Raw(this, &FWidgetManager::OnEstimateRenderCostClicked)
+				.Content()
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("EstimateRenderCostButtonText", "Estimate Rendering Cost"))
+				]
+			]
 		];
 }
 
@@ -528,6 +783,33 @@ FReply FWidgetManager::OnRenderImagesClicked()
 	return FReply::Handled();
 }
 
+FReply FWidgetManager::OnEstimateRenderCostClicked()
+{
+	FRenderCostEstimate Estimate;
+	if (!SequenceRenderer->EstimateRenderCost(
+		LevelSequenceAssetData,
+		SequenceRendererTargets,
+		OutputImageResolution,
+		OutputDirectory,
+		Estimate))
+	{
+		const FText MessageBoxTitle = LOCTEXT("EstimateRenderCostErrorMessageBoxTitle", "Could not estimate rendering cost");
+		FMessageDialog::Open(
+			EAppMsgType::Ok,
+			FText::FromString(SequenceRenderer->GetErrorMessage()),
+			&MessageBoxTitle);
+		return FReply::Handled();
+	}
+
+	const FText MessageBoxTitle = LOCTEXT("EstimateRenderCostMessageBoxTitle", "Estimated rendering cost");
+	FMessageDialog::Open(
+		EAppMsgType::Ok,
+		FText::FromString(Estimate.ToString()),
+		&MessageBoxTitle);
+
+	return FReply::Handled();
+}
+
 void FWidgetManager::OnSemanticClassesUpdated()
 {
 	// Refresh the list of semantic classes
@@ -580,6 +862,8 @@ void FWidgetManager::LoadWidgetOptionStates()
 		// Initialize the widget members using loaded options
 		LevelSequenceAssetData = FAssetData(WidgetStateAsset->LevelSequenceAssetPath.TryLoad());
 		SequenceRendererTargets.SetExportCameraPoses(WidgetStateAsset->bCameraPosesSelected);
+		SequenceRendererTargets.SetExportObjectPoses(WidgetStateAsset->bObjectPosesSelected);
+		SequenceRendererTargets.SetExportBoundingBoxes(WidgetStateAsset->bBoundingBoxesSelected);
 		SequenceRendererTargets.SetSelectedTarget(FRendererTargetOptions::COLOR_IMAGE, WidgetStateAsset->bColorImagesSelected);
 		SequenceRendererTargets.SetSelectedTarget(FRendererTargetOptions::DEPTH_IMAGE, WidgetStateAsset->bDepthImagesSelected);
 		SequenceRendererTargets.SetSelectedTarget(FRendererTargetOptions::NORMAL_IMAGE, WidgetStateAsset->bNormalImagesSelected);
@@ -606,7 +890,19 @@ void FWidgetManager::LoadWidgetOptionStates()
 			static_cast<EImageFormat>(WidgetStateAsset->bCustomPPMaterialOutputFormat));
 		OutputImageResolution = WidgetStateAsset->OutputImageResolution;
 		SequenceRendererTargets.SetDepthRangeMeters(WidgetStateAsset->DepthRange);
+		SequenceRendererTargets.SetDepthInMeters(WidgetStateAsset->bDepthInMeters);
 		SequenceRendererTargets.SetOpticalFlowScale(WidgetStateAsset->OpticalFlowScale);
+		SequenceRendererTargets.SetOpticalFlowInPixels(WidgetStateAsset->bOpticalFlowInPixels);
+		SequenceRendererTargets.SetSemanticClassIndices(WidgetStateAsset->bSemanticClassIndices);
+		SequenceRendererTargets.SetDatasetShardSizeMegabytes(WidgetStateAsset->DatasetShardSizeMegabytes);
+		SequenceRendererTargets.SetImuRateHz(WidgetStateAsset->ImuRateHz);
+		SequenceRendererTargets.SetImuGyroNoise(WidgetStateAsset->ImuGyroNoise);
+		SequenceRendererTargets.SetImuAccelNoise(WidgetStateAsset->ImuAccelNoise);
+		SequenceRendererTargets.SetSinglePassRendering(WidgetStateAsset->bSinglePassRendering);
+		SequenceRendererTargets.SetMultilayerExr(WidgetStateAsset->bMultilayerExr);
+		SequenceRendererTargets.SetParallelRigRendering(WidgetStateAsset->bParallelRigRendering);
+		SequenceRendererTargets.SetResumeRendering(WidgetStateAsset->bResumeRendering);
+		SequenceRendererTargets.SetReadinessTimeout(WidgetStateAsset->ReadinessTimeout);
 		OutputDirectory = WidgetStateAsset->OutputDirectory;
 	}
 }
@@ -639,6 +935,8 @@ void FWidgetManager::SaveWidgetOptionStates()
 	// Update asset values
 	WidgetStateAsset->LevelSequenceAssetPath = LevelSequenceAssetData.ToSoftObjectPath();
 	WidgetStateAsset->bCameraPosesSelected = SequenceRendererTargets.ExportCameraPoses();
+	WidgetStateAsset->bObjectPosesSelected = SequenceRendererTargets.ExportObjectPoses();
+	WidgetStateAsset->bBoundingBoxesSelected = SequenceRendererTargets.ExportBoundingBoxes();
 	WidgetStateAsset->bColorImagesSelected = SequenceRendererTargets.TargetSelected(FRendererTargetOptions::COLOR_IMAGE);
 	WidgetStateAsset->bDepthImagesSelected = SequenceRendererTargets.TargetSelected(FRendererTargetOptions::DEPTH_IMAGE);
 	WidgetStateAsset->bNormalImagesSelected = SequenceRendererTargets.TargetSelected(FRendererTargetOptions::NORMAL_IMAGE);
@@ -659,7 +957,19 @@ void FWidgetManager::SaveWidgetOptionStates()
 		SequenceRendererTargets.OutputFormat(FRendererTargetOptions::CUSTOM_PP_MATERIAL));
 	WidgetStateAsset->OutputImageResolution = OutputImageResolution;
 	WidgetStateAsset->DepthRange = SequenceRendererTargets.DepthRangeMeters();
+	WidgetStateAsset->bDepthInMeters = SequenceRendererTargets.DepthInMeters();
 	WidgetStateAsset->OpticalFlowScale = SequenceRendererTargets.OpticalFlowScale();
+	WidgetStateAsset->bOpticalFlowInPixels = SequenceRendererTargets.OpticalFlowInPixels();
+	WidgetStateAsset->bSemanticClassIndices = SequenceRendererTargets.SemanticClassIndices();
+	WidgetStateAsset->DatasetShardSizeMegabytes = SequenceRendererTargets.DatasetShardSizeMegabytes();
+	WidgetStateAsset->ImuRateHz = SequenceRendererTargets.ImuRateHz();
+	WidgetStateAsset->ImuGyroNoise = SequenceRendererTargets.ImuGyroNoise();
+	WidgetStateAsset->ImuAccelNoise = SequenceRendererTargets.ImuAccelNoise();
+	WidgetStateAsset->bSinglePassRendering = SequenceRendererTargets.SinglePassRendering();
+	WidgetStateAsset->bMultilayerExr = SequenceRendererTargets.MultilayerExr();
+	WidgetStateAsset->bParallelRigRendering = SequenceRendererTargets.ParallelRigRendering();
+	WidgetStateAsset->bResumeRendering = SequenceRendererTargets.ResumeRendering();
+	WidgetStateAsset->ReadinessTimeout = SequenceRendererTargets.ReadinessTimeout();
 	WidgetStateAsset->OutputDirectory = OutputDirectory;
 
 	// Save the asset
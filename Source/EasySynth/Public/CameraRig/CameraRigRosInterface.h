@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 
+#include "CameraRig/CameraRigData.h"
+
 #include "CameraRigRosInterface.generated.h"
 
 class UCameraComponent;
@@ -65,6 +67,21 @@ public:
 	/** Imports camera rig from a ROS JSON file */
 	FReply OnImportCameraRigClicked();
 
+	/** Reads camera rig data from a ROS JSON file */
+	bool LoadCameraRig(
+		const FString& FilePath,
+		FCameraRigData& OutCameraRigData,
+		FText& OutErrorMessage);
+
+	/**
+	 * Calculates the row-major 3x3 intrinsics matrix of the camera rendering images of the sensor size,
+	 * the matrix exported for each rig camera
+	 */
+	static TArray<double> CameraIntrinsics(const UCameraComponent* Camera, const FIntPoint& SensorSize);
+
+	/** Calculates the horizontal field of view in degrees from the camera intrinsics */
+	static double FieldOfView(const FCameraRigData::FCameraData& Camera);
+
 	/** Exports camera rig into a ROS JSON file */
 	bool ExportCameraRig(
 		const FString& OutputDir,
@@ -0,0 +1,141 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "Commandlets/ShardWorkQueue.h"
+#include "RenderJobSpec.h"
+
+#include "EasySynthRenderCommandlet.generated.h"
+
+class FRendererTargetOptions;
+struct FRenderProgress;
+class USequenceRenderer;
+
+
+/**
+ * Commandlet that renders level sequences described by a JSON job spec file without the plugin UI
+ * Usage: UnrealEditor-Cmd <Project> -run=EasySynthRender -Spec=<SpecFile> [-Shards=<N> [-WorkerTimeout=<Seconds>]] [-DryRun] [-BenchmarkExrCodecs [-BenchmarkImages=<N>]] [-BenchmarkPoseExport] -AllowCommandletRendering -unattended -RenderOffscreen
+ * With -Shards, frame ranges of sequences are split between N worker processes
+ * that coordinate through a file-based work queue, and their outputs are merged afterwards
+ * Shards of workers that exit or make no progress for the worker timeout are requeued
+ * With -DryRun, only the output size and the rendering time are estimated and nothing is rendered
+ * With -BenchmarkExrCodecs, nothing is rendered and EXR images of a previous run are encoded with every compression method
+ * With -BenchmarkPoseExport, nothing is rendered and camera poses are extracted with both the batched and the per frame evaluation,
+ * which requires EasySynth.PoseInterrogationBatchSize to be raised above 1
+ * Returns a non-zero exit code if any of the sequences fails to render
+*/
+UCLASS()
+class UEasySynthRenderCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UEasySynthRenderCommandlet();
+
+	/** UCommandlet interface */
+	int32 Main(const FString& Params) override;
+
+private:
+	/** Logs the estimated cost of rendering each sequence, fails if the outputs would not fit on the disk */
+	int32 EstimateRenderCost(
+		USequenceRenderer* SequenceRenderer,
+		const FRenderJobSpec& JobSpec,
+		const FRendererTargetOptions& TargetOptions);
+
+	/** Encodes a sample of previously rendered EXR images of each target with every compression method */
+	int32 BenchmarkExrCodecs(const FRenderJobSpec& JobSpec, const int32 ImagesPerTarget);
+
+	/** Compares the duration and the output of the batched and the per frame camera pose evaluation */
+	int32 BenchmarkPoseExport(const FRenderJobSpec& JobSpec);
+
+	/** Splits sequences into shards, runs worker processes and merges their outputs */
+	int32 RunShardCoordinator(
+		const FRenderJobSpec& JobSpec,
+		const FString& SpecFilePath,
+		const int32 NumShards,
+		const double WorkerTimeoutSeconds);
+
+	/** Launches a worker process of the sharded rendering, adding it to the workers mapped by process ids */
+	static void LaunchShardWorker(const FString& WorkerParams, TMap<uint32, FProcHandle>& Workers);
+
+	/** Renders shards claimed from the work queue until none are left */
+	int32 RunShardWorker(
+		USequenceRenderer* SequenceRenderer,
+		const FRenderJobSpec& JobSpec,
+		const FRendererTargetOptions& TargetOptions,
+		const FString& ShardQueueDir);
+
+	/** Renders a single level sequence, waiting for the rendering to finish */
+	bool RenderLevelSequence(
+		USequenceRenderer* SequenceRenderer,
+		const FString& LevelSequencePath,
+		const FRendererTargetOptions& TargetOptions,
+		const FIntPoint& OutputResolution,
+		const FString& OutputDirectory);
+
+	/** Rendering finished handle */
+	void OnRenderingFinished(bool bSuccess) { bRenderingSucceeded = bSuccess; }
+
+	/** Rendering progress handle, logs the progress at most once per log interval */
+	void OnRenderProgress(const FRenderProgress& Progress);
+
+	/** Render queue finished handle */
+	void OnQueueFinished(int NumFailedEntries) { NumFailedSequences += NumFailedEntries; }
+
+	/** Reads the job spec JSON file */
+	static bool LoadJobSpec(const FString& SpecFilePath, FRenderJobSpec& OutJobSpec);
+
+	/** Returns the output directory of the level sequence */
+	static FString SequenceOutputDir(const FRenderJobSpec& JobSpec, const FString& LevelSequencePath);
+
+	/** Gets the range of sequence display frames covered by the playback range */
+	static bool GetSequenceFrameRange(const FString& LevelSequencePath, TRange<int32>& OutFrameRange);
+
+	/** Moves shard outputs into the output directory and combines their camera pose files */
+	static bool MergeShardOutputs(const FString& OutputDirectory, const TArray<FRenderShard>& Shards);
+
+	/** Ticks the engine until the sequence renderer finishes the rendering and the render queue */
+	static void TickUntilRenderingFinished(USequenceRenderer* SequenceRenderer);
+
+	/** Result of the latest rendering */
+	bool bRenderingSucceeded;
+
+	/** Number of sequences that failed to render */
+	int32 NumFailedSequences;
+
+	/** Time at which the progress was last logged */
+	double LastProgressLogTime;
+
+	/** Work queue of the shard rendered by this worker, null if none is being rendered */
+	FShardWorkQueue* ActiveShardWorkQueue;
+
+	/** Shard rendered by this worker */
+	FRenderShard ActiveShard;
+
+	/** Number of completed frames at the latest shard heartbeat */
+	int32 HeartbeatFramesCompleted;
+
+	/** Number of images of each target encoded by the EXR compression benchmark, if not specified */
+	static const int32 DefaultBenchmarkImages;
+
+	/** Minimum time between two progress log lines */
+	static const double ProgressLogIntervalSeconds;
+
+	/** Time without rendering progress after which a worker is considered stalled, if not specified */
+	static const double DefaultWorkerTimeoutSeconds;
+
+	/** Time between two consecutive checks of the worker processes */
+	static const float WorkerPollIntervalSeconds;
+
+	/** Number of times a shard is rendered before it is considered failed */
+	static const int32 MaxShardAttempts;
+
+	/** Exit code returned on success */
+	static const int32 ExitCodeSuccess;
+
+	/** Exit code returned on failure */
+	static const int32 ExitCodeFailure;
+};
@@ -0,0 +1,115 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "ShardWorkQueue.generated.h"
+
+
+/**
+ * Structure representing the exact structure of a single shard file inside the work queue.
+ * Member names are lower case, as they need to exactly match the JSON file content.
+ */
+USTRUCT()
+struct FRenderShard
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Unique shard identifier, shards of the same sequence are ordered by it */
+	UPROPERTY()
+	FString id;
+
+	/** Level sequence asset to be rendered */
+	UPROPERTY()
+	FString level_sequence;
+
+	/** Inclusive first sequence display frame of the shard */
+	UPROPERTY()
+	int32 start_frame = 0;
+
+	/** Exclusive last sequence display frame of the shard */
+	UPROPERTY()
+	int32 end_frame = 0;
+
+	/** Directory receiving the shard outputs */
+	UPROPERTY()
+	FString output_dir;
+
+	/** Id of the process that claimed the shard, zero while the shard is not claimed */
+	UPROPERTY()
+	int32 worker_pid = 0;
+
+	/** Number of claims of the shard that ended without completing it */
+	UPROPERTY()
+	int32 attempts = 0;
+};
+
+
+/**
+ * File-based work queue shared by local rendering processes.
+ * Each shard is a file that moves between the pending, claimed, done and failed
+ * directories, and processes claim shards by atomically renaming their files,
+ * so no coordination service is needed
+ * The time stamp of a claimed shard file serves as the heartbeat of the process rendering it
+*/
+class FShardWorkQueue
+{
+public:
+	explicit FShardWorkQueue(const FString& QueueDir) : QueueDir(QueueDir) {}
+
+	/** Clears the queue and adds the shards as pending */
+	bool Create(const TArray<FRenderShard>& Shards);
+
+	/** Claims a pending shard for the current process, returns false if there are none left */
+	bool Claim(FRenderShard& OutShard);
+
+	/** Marks a claimed shard as done or failed */
+	bool Complete(const FRenderShard& Shard, const bool bSuccess);
+
+	/** Marks a claimed shard as still being rendered */
+	void Heartbeat(const FRenderShard& Shard) const;
+
+	/** Returns the time since the latest heartbeat of a claimed shard, or since its claim */
+	double SecondsSinceHeartbeat(const FRenderShard& Shard) const;
+
+	/**
+	 * Returns a claimed shard to the pending ones, so that another process renders it,
+	 * or marks it as failed once it has been attempted the maximum number of times
+	*/
+	bool Requeue(const FRenderShard& Shard, const int32 MaxAttempts);
+
+	/** Returns all currently claimed shards */
+	TArray<FRenderShard> ClaimedShards() const;
+
+	/** Returns the number of shards waiting to be claimed */
+	int32 NumPendingShards() const { return ShardIds(PendingDirName).Num(); }
+
+	/** Returns ids of shards that were not completed successfully */
+	TArray<FString> UnfinishedShardIds() const;
+
+private:
+	/** Path to the shard file inside the queue state directory */
+	FString ShardFilePath(const FString& StateDirName, const FString& ShardId) const;
+
+	/** Moves a shard file between queue state directories */
+	bool MoveShard(const FString& ShardId, const FString& FromDirName, const FString& ToDirName) const;
+
+	/** Reads a shard file */
+	static bool LoadShard(const FString& FilePath, FRenderShard& OutShard);
+
+	/** Writes a shard file */
+	static bool SaveShard(const FString& FilePath, const FRenderShard& Shard);
+
+	/** Lists ids of shards inside the queue state directory */
+	TArray<FString> ShardIds(const FString& StateDirName) const;
+
+	/** Root directory of the queue */
+	const FString QueueDir;
+
+	/** Queue state directory names */
+	static const FString PendingDirName;
+	static const FString ClaimedDirName;
+	static const FString DoneDirName;
+	static const FString FailedDirName;
+};
@@ -0,0 +1,135 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "DatasetShardWriter.h"
+
+
+/**
+ * Class that packs rendered images into dataset shards, receiving the encoded images from their write tasks
+ * instead of the images being written into files and read back
+ * A sample holds the images of all targets for a camera frame, so that a single shard stream covers the dataset,
+ * and it is appended once all of its images are received
+ * Targets are rendered by separate jobs, so images wait in memory for the rest of their sample,
+ * and are written into their regular files once the waiting images exceed the memory budget,
+ * to be read back when their sample is complete
+ * Cameras and targets are added before the packer is activated, images may arrive from any thread
+*/
+class FDatasetShardPacker
+{
+public:
+	FDatasetShardPacker(const FString& ShardDirectory, const int64 MaxShardBytes);
+
+	/**
+	 * Removes shards of a previous rendering, unless resuming,
+	 * in which case new shards are numbered after the existing ones
+	*/
+	void Open(const bool bResume);
+
+	/**
+	 * Adds the camera whose images are packed, images are written to the rig camera directory
+	 * Rows of the camera poses file are paired in order with the frame numbers they were exported for,
+	 * an empty poses file path packs samples without poses
+	*/
+	bool AddCamera(
+		const FString& RigCameraDir,
+		const FString& CameraName,
+		const FString& PosesFilePath,
+		const TArray<int32>& PoseFrameNumbers);
+
+	/** Adds outputs of a target, a sample is complete once it holds an image of each added output */
+	void AddTarget(const TArray<FString>& TargetOutputNames);
+
+	/** Checks if the image written to the file path belongs to a packed camera and output */
+	bool AcceptsImage(const FString& FilePath) const;
+
+	/** Adds the encoded image to the sample of its frame, appending the sample once all of its images are added */
+	bool AddImage(const FString& FilePath, TArray64<uint8>&& Data);
+
+	/** Finishes the shards, images of incomplete samples are written into their regular files */
+	bool Close();
+
+	/** Sets the packer that receives rendered images, nullptr stops packing */
+	static void SetActive(const TSharedPtr<FDatasetShardPacker>& Packer);
+
+	/** Checks if the image written to the file path is handed to the active packer instead of being written */
+	static bool IsPacked(const FString& FilePath);
+
+	/** Hands the encoded image to the active packer, writing it into the file if there is none */
+	static bool PackImage(const FString& FilePath, TArray64<uint8>&& Data);
+
+private:
+	/** Camera whose images are packed */
+	struct FPackedCamera
+	{
+		FString CameraName;
+
+		/** Header of the camera poses file, empty if poses are not packed */
+		FString PoseHeader;
+
+		/** Rows of the camera poses file by their frame numbers */
+		TMap<int32, FString> FramePoses;
+	};
+
+	/** Sample whose images are still being rendered */
+	struct FPendingSample
+	{
+		/** Images held in memory */
+		TArray<FDatasetSampleMember> Members;
+
+		/** Files the images held in memory belong to */
+		TArray<FString> FilePaths;
+
+		/** Images written into their files, as the memory budget was exceeded */
+		TArray<FString> WrittenFilePaths;
+
+		int32 NumImages() const { return Members.Num() + WrittenFilePaths.Num(); }
+	};
+
+	/** Finds the camera, the output and the frame number of the image written to the file path */
+	const FPackedCamera* FindImageCamera(const FString& FilePath, FString& OutOutputName, int32& OutFrameNumber) const;
+
+	/** Appends the complete sample to the shard, adding the pose of the frame */
+	bool AppendSample(const FPackedCamera& Camera, const int32 FrameNumber, FPendingSample& Sample);
+
+	/** Directory holding the shards */
+	const FString ShardDirectory;
+
+	/** Size after which a new shard is started */
+	const int64 MaxShardBytes;
+
+	/** Size of images waiting for their samples, after which images are written into files */
+	const int64 MaxPendingBytes;
+
+	/** Whether new shards are numbered after existing ones */
+	bool bResume;
+
+	/** Packed cameras by their full rig camera directory */
+	TMap<FString, FPackedCamera> Cameras;
+
+	/** Names of the packed outputs */
+	TSet<FString> OutputNames;
+
+	/** Shard writer, created with the first sample */
+	TUniquePtr<FDatasetShardWriter> Writer;
+
+	/** Samples waiting for the rest of their images, by the camera and frame */
+	TMap<FString, FPendingSample> PendingSamples;
+
+	/** Size of images held in memory by the pending samples */
+	int64 PendingBytes;
+
+	/** Number of appended samples */
+	int32 NumSamples;
+
+	/** Guards the pending samples and the shard writer */
+	FCriticalSection CriticalSection;
+
+	/** Packer receiving rendered images */
+	static TSharedPtr<FDatasetShardPacker> ActivePacker;
+
+	/** Guards the active packer */
+	static FCriticalSection ActivePackerCriticalSection;
+};
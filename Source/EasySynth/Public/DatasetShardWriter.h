@@ -0,0 +1,106 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IFileHandle;
+
+
+/**
+ * Member of a dataset sample, stored as a separate file inside the shard
+*/
+struct FDatasetSampleMember
+{
+	/** Extension that follows the sample key inside the member name, e.g. ColorImage.jpeg */
+	FString Extension;
+
+	/** Content of the member file */
+	TArray64<uint8> Data;
+};
+
+
+/**
+ * Class that sequentially appends dataset samples into WebDataset-style tar shards
+ * Members of a sample are named <key>.<extension> and are always written into the same shard,
+ * while a new shard is started once the current one reaches the maximum size
+ * A shard is written under a temporary name and renamed once it is finished,
+ * so that shards interrupted by a crash are never mistaken for complete ones
+*/
+class FDatasetShardWriter
+{
+public:
+	FDatasetShardWriter(const FString& ShardDirectory, const int64 MaxShardBytes, const int32 FirstShardIndex = 0);
+
+	~FDatasetShardWriter();
+
+	/** Appends the sample to the current shard, starting a new shard if the current one is full */
+	bool AddSample(const FString& Key, const TArray<FDatasetSampleMember>& Members);
+
+	/** Finishes the current shard and gives it its final name, returns false if any of the writes failed */
+	bool Close();
+
+	/** Returns the number of written shards */
+	int32 NumShards() const { return ShardIndex + 1 - FirstShardIndex; }
+
+	/** Returns the number of written samples */
+	int32 NumSamples() const { return SampleCount; }
+
+	/** Returns the file name of the shard with the index */
+	static FString ShardFileName(const int32 Index);
+
+	/** Returns the index following the last shard inside the directory */
+	static int32 NextShardIndex(const FString& ShardDirectory);
+
+private:
+	/** Finishes the current shard and opens the next one */
+	bool StartNextShard();
+
+	/** Returns the path the shard with the index is written to until it is finished */
+	FString TemporaryShardFilePath(const int32 Index) const
+	{
+		return ShardDirectory / ShardFileName(Index) + TemporaryExtension;
+	}
+
+	/** Writes the tar header and the padded content of a single member file */
+	bool WriteMember(const FString& MemberName, const TArray64<uint8>& Data);
+
+	/** Writes bytes into the current shard file */
+	bool Write(const uint8* Data, const int64 NumBytes);
+
+	/** Fills the tar header block of a regular file */
+	static bool FillHeader(const FString& MemberName, const int64 FileSize, uint8* OutHeader);
+
+	/** Writes the value as a zero padded, null terminated octal number into the header field */
+	static void WriteOctal(uint8* Field, const int32 FieldSize, const int64 Value);
+
+	/** Directory shard files are written into */
+	const FString ShardDirectory;
+
+	/** Size after which a new shard is started */
+	const int64 MaxShardBytes;
+
+	/** Index of the first shard written by this writer */
+	const int32 FirstShardIndex;
+
+	/** Handle of the current shard file */
+	TUniquePtr<IFileHandle> ShardFile;
+
+	/** Index of the current shard, one before the first shard index before the first sample */
+	int32 ShardIndex;
+
+	/** Number of bytes written into the current shard */
+	int64 ShardBytes;
+
+	/** Number of written samples */
+	int32 SampleCount;
+
+	/** Whether any of the writes failed */
+	bool bFailed;
+
+	/** Size of tar header and data blocks */
+	static constexpr int64 TarBlockSize = 512;
+
+	/** Extension appended to the names of unfinished shards */
+	static const FString TemporaryExtension;
+};
@@ -0,0 +1,46 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+ * Helpers for NumPy array files, used for outputs that are too large to be written as CSV
+ * Data types are passed as the Python literals written into the header, e.g. '<f8' including the quotes,
+ * or a list of named fields for structured arrays
+*/
+class FNpyFile
+{
+public:
+	/**
+	 * Opens the file and writes the header, leaving the data to be written by the caller
+	 * The header has room for any shape with the same number of dimensions, so it can be updated once the data is written
+	 */
+	static TUniquePtr<FArchive> CreateWriter(const FString& FilePath, const FString& DataType, const TArray<int64>& Shape);
+
+	/** Rewrites the header of a file opened by CreateWriter, e.g. once the number of rows is known */
+	static void UpdateShape(FArchive& Writer, const FString& DataType, const TArray<int64>& Shape);
+
+	/** Loads a file written by this class */
+	static bool Load(const FString& FilePath, FString& OutDataType, TArray<int64>& OutShape, TArray64<uint8>& OutData);
+
+	/** Concatenates files along the first dimension, requiring all other dimensions and the data type to match */
+	static bool Concatenate(const TArray<FString>& FilePaths, const FString& OutputFilePath);
+
+private:
+	/** Writes the magic string, the version and the header padded to the size fitting any shape of the dimensions */
+	static void WriteHeader(FArchive& Writer, const FString& DataType, const TArray<int64>& Shape);
+
+	/** Returns the header dictionary of the array */
+	static FString HeaderDictionary(const FString& DataType, const TArray<FString>& Dimensions);
+
+	/** Magic string that starts every file */
+	static const uint8 Magic[6];
+
+	/** Size of the magic string, the version and the header length preceding the header */
+	static const int32 PreambleSize;
+
+	/** Number of digits reserved for each dimension of the shape */
+	static const int32 MaxDimensionDigits;
+};
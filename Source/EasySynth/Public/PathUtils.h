@@ -116,6 +116,12 @@ public:
 		return Directory / SemanticClassesFileName;
 	}
 
+	/** Full path to the semantic class indices CSV file */
+	static FString SemanticClassIndicesFilePath(const FString& Directory)
+	{
+		return Directory / SemanticClassIndicesFileName;
+	}
+
 	/** Gets original camera name from the received camera component */
 	static FString GetCameraName(UCameraComponent* CameraComponent)
 	{
@@ -141,6 +147,78 @@ public:
 		return Directory / CameraPosesFileName;
 	}
 
+	/** Full path to the bounding boxes output file of the specific rig camera */
+	static FString BoundingBoxesFilePath(const FString& Directory, UCameraComponent* CameraComponent)
+	{
+		return RigCameraDir(Directory, CameraComponent) / BoundingBoxesFileName;
+	}
+
+	/** Full path to the table of actors bounding boxes are exported for */
+	static FString BoundingBoxObjectsFilePath(const FString& Directory)
+	{
+		return Directory / BoundingBoxObjectsFileName;
+	}
+
+	/** Path to the directory containing object pose columns */
+	static FString ObjectPosesDir(const FString& Directory)
+	{
+		return Directory / ObjectPosesDirName;
+	}
+
+	/** Full path to the IMU samples CSV file */
+	static FString ImuFilePath(const FString& Directory)
+	{
+		return Directory / ImuFileName;
+	}
+
+	/** Full path to the render stage timings CSV file */
+	static FString TimingsFilePath(const FString& Directory)
+	{
+		return Directory / TimingsFileName;
+	}
+
+	/** Full path to the render history CSV file kept inside the project Saved directory across renderings */
+	static FString RenderHistoryFilePath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("EasySynth") / RenderHistoryFileName;
+	}
+
+	/** Full path to the EXR compression benchmark CSV file */
+	static FString ExrCodecBenchmarkFilePath(const FString& Directory)
+	{
+		return Directory / ExrCodecBenchmarkFileName;
+	}
+
+	/** Full path to the persistent render queue JSON file */
+	static FString RenderQueueFilePath(const FString& Directory)
+	{
+		return Directory / RenderQueueFileName;
+	}
+
+	/** Path to the directory containing intermediate outputs of sharded rendering */
+	static FString ShardsDir(const FString& Directory)
+	{
+		return Directory / ShardsDirName;
+	}
+
+	/** Path to the directory containing packed dataset shards */
+	static FString DatasetShardsDir(const FString& Directory)
+	{
+		return Directory / DatasetShardsDirName;
+	}
+
+	/** Path to the sharded rendering work queue directory */
+	static FString ShardQueueDir(const FString& Directory)
+	{
+		return ShardsDir(Directory) / ShardQueueDirName;
+	}
+
+	/** Path to the output directory of a single shard */
+	static FString ShardOutputDir(const FString& Directory, const FString& ShardId)
+	{
+		return ShardsDir(Directory) / ShardId;
+	}
+
 	/** Clean name of the rendering output directory */
 	static const FString RenderingOutputDirName;
 
@@ -150,6 +228,42 @@ public:
 	/** Clean name of the semantic classes CSV output file */
 	static const FString SemanticClassesFileName;
 
+	/** Clean name of the semantic class indices CSV output file */
+	static const FString SemanticClassIndicesFileName;
+
 	/** Clean name of the camera poses output file */
 	static const FString CameraPosesFileName;
+
+	/** Clean name of the bounding boxes output file */
+	static const FString BoundingBoxesFileName;
+
+	/** Clean name of the bounding box actors output file */
+	static const FString BoundingBoxObjectsFileName;
+
+	/** Clean name of the object poses output directory */
+	static const FString ObjectPosesDirName;
+
+	/** Clean name of the IMU samples output file */
+	static const FString ImuFileName;
+
+	/** Clean name of the render stage timings CSV file */
+	static const FString TimingsFileName;
+
+	/** Clean name of the render history CSV file */
+	static const FString RenderHistoryFileName;
+
+	/** Clean name of the EXR compression benchmark CSV file */
+	static const FString ExrCodecBenchmarkFileName;
+
+	/** Clean name of the render queue JSON file */
+	static const FString RenderQueueFileName;
+
+	/** Clean name of the sharded rendering intermediate output directory */
+	static const FString ShardsDirName;
+
+	/** Clean name of the packed dataset shards directory */
+	static const FString DatasetShardsDirName;
+
+	/** Clean name of the sharded rendering work queue directory */
+	static const FString ShardQueueDirName;
 };
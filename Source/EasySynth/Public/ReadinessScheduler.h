@@ -0,0 +1,68 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+
+/**
+ * Class that delays the start of the next rendering job until the engine
+ * finishes compiling shaders and assets and streaming textures
+ * requested by the latest changes to the world, or the timeout expires
+ * Pending work that stays unchanged without any shader jobs is reported as stalled,
+ * as some counters never drain, e.g. textures that cannot be fully streamed in
+*/
+class FReadinessScheduler
+{
+public:
+	FReadinessScheduler() :
+		WaitStartTime(0.0),
+		TimeoutSeconds(DefaultTimeoutSeconds),
+		PreviousNumPendingWork(0),
+		LastChangeTime(0.0),
+		bStalled(false)
+	{}
+
+	/** Executes the delegate once the engine is ready to render, or the timeout expires */
+	void Schedule(FSimpleDelegate OnReady, const float Timeout);
+
+	/** Stops waiting without executing the delegate */
+	void Cancel();
+
+	/** Default time to wait for the engine to become ready */
+	static const float DefaultTimeoutSeconds;
+
+private:
+	/** Checks readiness and executes the delegate once it is reached */
+	void Poll();
+
+	/** Counts pending work items that affect rendering, describes them if found */
+	static int32 NumPendingWork(FString& OutPendingWork, bool& bOutCompilingShaders);
+
+	/** Handle of the timer polling the engine state */
+	FTimerHandle PollTimerHandle;
+
+	/** Delegate to be executed once the engine is ready */
+	FSimpleDelegate ReadyDelegate;
+
+	/** Time at which the waiting started */
+	double WaitStartTime;
+
+	/** Maximum time to wait for the engine to become ready */
+	float TimeoutSeconds;
+
+	/** Number of pending work items seen by the previous check */
+	int32 PreviousNumPendingWork;
+
+	/** Time at which the number of pending work items last changed */
+	double LastChangeTime;
+
+	/** Whether the pending work was reported as stalled during the current wait */
+	bool bStalled;
+
+	/** Time between two consecutive readiness checks */
+	static const float PollIntervalSeconds;
+
+	/** Time without a change of pending work after which the engine is considered stalled */
+	static const float StallSeconds;
+};
@@ -0,0 +1,102 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IImageWrapper.h"
+
+#include "RenderTelemetry.h"
+
+
+/**
+ * Estimated cost of a rendering run, computed without rendering
+ * Output sizes and render times are based on the render history of previous runs,
+ * while output sizes of targets without history are conservative approximations
+*/
+class FRenderCostEstimate
+{
+public:
+	/** Estimated cost of a single target */
+	struct FTargetEstimate
+	{
+		/** Name of the target */
+		FString TargetName;
+
+		/** Output image format of the target */
+		EImageFormat ImageFormat;
+
+		/** Number of images written by all cameras */
+		int64 NumFiles;
+
+		/** Size of images written by all cameras */
+		int64 NumBytes;
+
+		/** Time needed to render all cameras, negative if unknown */
+		double RenderSeconds;
+	};
+
+	FRenderCostEstimate() :
+		NumFrames(0),
+		NumCameras(0),
+		TotalFiles(0),
+		TotalBytes(0),
+		TotalRenderSeconds(0.0),
+		FreeDiskBytes(-1),
+		bExceedsFreeDiskSpace(false)
+	{}
+
+	/**
+	 * Adds the estimate of the target rendered by all cameras, using
+	 * the previously measured frame cost if available
+	 * Targets rendered inside a single pass write a file for each of their outputs
+	*/
+	void AddTarget(
+		const FString& TargetName,
+		const EImageFormat ImageFormat,
+		const int32 NumOutputs,
+		const FIntPoint& OutputResolution,
+		const FRenderTelemetry::FFrameCost* FrameCost);
+
+	/** Compares the estimated output size with the free space of the disk holding the output directory */
+	void CheckFreeDiskSpace(const FString& OutputDirectory);
+
+	/** Describes the estimate in multiple lines */
+	FString ToString() const;
+
+	/** Estimates the size of a single image file without any measurements */
+	static int64 EstimateImageBytes(const EImageFormat ImageFormat, const FIntPoint& OutputResolution);
+
+	/** Number of rendered sequence frames, covered by camera cut sections */
+	int32 NumFrames;
+
+	/** Number of cameras inside the rig */
+	int32 NumCameras;
+
+	/** Estimates of each target */
+	TArray<FTargetEstimate> Targets;
+
+	/** Number of images written by all targets */
+	int64 TotalFiles;
+
+	/** Size of images written by all targets */
+	int64 TotalBytes;
+
+	/** Time needed to render all targets, negative if unknown for any of the targets */
+	double TotalRenderSeconds;
+
+	/** Free space of the disk holding the output directory, negative if unknown */
+	int64 FreeDiskBytes;
+
+	/** Whether the estimated output size exceeds the free disk space */
+	bool bExceedsFreeDiskSpace;
+
+private:
+	/** Approximate compressed size of a JPEG pixel */
+	static const double JpegBytesPerPixel;
+
+	/** Approximate compressed size of an 8-bit RGBA PNG pixel */
+	static const double PngBytesPerPixel;
+
+	/** Approximate compressed size of a 16-bit RGBA EXR pixel */
+	static const double ExrBytesPerPixel;
+};
@@ -0,0 +1,193 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "RenderJobSpec.generated.h"
+
+class FRendererTargetOptions;
+
+
+/**
+ * Structure representing a single rendering target inside of the render job spec JSON file.
+ * Member names are lower case, as they need to exactly match the JSON file content.
+ */
+USTRUCT()
+struct FRenderJobSpecTarget
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Target name, one of color, depth, normal, optical_flow, semantic and custom_pp_material */
+	UPROPERTY()
+	FString name;
+
+	/** Output image format, one of jpeg, png and exr */
+	UPROPERTY()
+	FString format;
+};
+
+
+/**
+ * Structure representing the exact structure of render job spec JSON files and render queue entries.
+ * Member names are lower case, as they need to exactly match the JSON file content.
+ */
+USTRUCT()
+struct FRenderJobSpec
+{
+	GENERATED_USTRUCT_BODY()
+
+	FRenderJobSpec();
+
+	/** Converts the spec into renderer target options */
+	bool GetRendererTargetOptions(FRendererTargetOptions& OutTargetOptions) const;
+
+	/** Creates the spec describing the renderer target options */
+	static FRenderJobSpec FromRendererTargetOptions(const FRendererTargetOptions& TargetOptions);
+
+	/** Map to be loaded before rendering, the currently loaded map is used if empty */
+	UPROPERTY()
+	FString map;
+
+	/** Level sequence assets to be rendered */
+	UPROPERTY()
+	TArray<FString> level_sequences;
+
+	/** Rendering targets */
+	UPROPERTY()
+	TArray<FRenderJobSpecTarget> targets;
+
+	/** Whether to export camera poses */
+	UPROPERTY()
+	bool camera_poses;
+
+	/** Whether to export poses of objects bound to the sequence */
+	UPROPERTY()
+	bool object_poses;
+
+	/** Whether to export bounding boxes of actors with a semantic class */
+	UPROPERTY()
+	bool bounding_boxes;
+
+	/** Depth range in meters */
+	UPROPERTY()
+	float depth_range;
+
+	/** Whether depth is written as float values in meters, requires the exr format */
+	UPROPERTY()
+	bool depth_meters;
+
+	/** Optical flow scale coefficient */
+	UPROPERTY()
+	float optical_flow_scale;
+
+	/** Whether optical flow is written as float vectors in pixels, requires the exr format */
+	UPROPERTY()
+	bool optical_flow_pixels;
+
+	/** Whether semantic images are written as class indices, requires the png format */
+	UPROPERTY()
+	bool semantic_class_indices;
+
+	/** Whether exr targets are written as layers of a single file per frame */
+	UPROPERTY()
+	bool multilayer_exr;
+
+	/** Size of tar shards the outputs are packed into, zero keeps separate files */
+	UPROPERTY()
+	int32 dataset_shard_mb;
+
+	/** Rate of exported rig IMU samples in Hz, zero disables the IMU export */
+	UPROPERTY()
+	float imu_rate_hz;
+
+	/** Standard deviation of the simulated gyroscope noise in rad/s */
+	UPROPERTY()
+	float imu_gyro_noise;
+
+	/** Standard deviation of the simulated accelerometer noise in m/s^2 */
+	UPROPERTY()
+	float imu_accel_noise;
+
+	/** Custom post process material asset used by the custom_pp_material target */
+	UPROPERTY()
+	FString custom_pp_material;
+
+	/** Whether compatible targets are rendered in a single pass */
+	UPROPERTY()
+	bool single_pass;
+
+	/** Whether all rig cameras are rendered in a single run */
+	UPROPERTY()
+	bool parallel_rig;
+
+	/** Whether frames rendered by a previous run into the output directory are skipped */
+	UPROPERTY()
+	bool resume;
+
+	/** Maximum wait for the engine readiness before each render in seconds */
+	UPROPERTY()
+	float readiness_timeout;
+
+	/** Array containing two numbers representing output image width and height */
+	UPROPERTY()
+	TArray<int32> resolution;
+
+	/** Output directory, each sequence is rendered into its own subdirectory if multiple are provided */
+	UPROPERTY()
+	FString output_dir;
+
+	/** Optional camera rig ROS JSON file overriding the sequence rig cameras */
+	UPROPERTY()
+	FString camera_rig;
+};
+
+
+/**
+ * Structure representing a single job inside the render queue JSON file.
+ * Member names are lower case, as they need to exactly match the JSON file content.
+ */
+USTRUCT()
+struct FRenderQueueEntry
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Job description, containing a single level sequence */
+	UPROPERTY()
+	FRenderJobSpec job;
+
+	/** Job status, one of pending, rendering, done and failed */
+	UPROPERTY()
+	FString status;
+
+	/** Error message of a failed job */
+	UPROPERTY()
+	FString error;
+
+	/** Status of a job waiting to be rendered */
+	static const FString StatusPending;
+
+	/** Status of the job being rendered */
+	static const FString StatusRendering;
+
+	/** Status of a successfully rendered job */
+	static const FString StatusDone;
+
+	/** Status of a job that failed to render */
+	static const FString StatusFailed;
+};
+
+
+/**
+ * Structure representing the exact structure of the render queue JSON file.
+ * Member names are lower case, as they need to exactly match the JSON file content.
+ */
+USTRUCT()
+struct FRenderQueueContent
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Queued jobs in the rendering order */
+	UPROPERTY()
+	TArray<FRenderQueueEntry> jobs;
+};
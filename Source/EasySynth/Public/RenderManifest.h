@@ -0,0 +1,114 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Queue.h"
+
+
+/**
+ * Class that tracks rendered (camera, target, frame) tuples inside a CSV file
+ * in the output directory, so that an interrupted rendering can be resumed
+ * by rendering only the frames that are missing
+ * Frames are recorded once the image write tasks writing them complete
+*/
+class FRenderManifest
+{
+public:
+	FRenderManifest() :
+		RecordedFiles(0),
+		RecordedBytes(0)
+	{}
+
+	/** Opens the manifest inside the output directory, clears it unless resuming */
+	bool Open(const FString& OutputDirectory, const bool bResume);
+
+	/**
+	 * Chains onto the future of an image write task, queueing the file to be recorded once it is fully written,
+	 * safe to call from any thread
+	 * Images handed to the dataset shard packer instead of being written are queued by the packer
+	*/
+	static TFuture<bool> TrackWrite(TFuture<bool>&& WriteFuture, const FString& FilePath);
+
+	/** Queues the image to be recorded with its size, safe to call from any thread */
+	static void AddWrittenFile(const FString& FilePath, const int64 NumBytes)
+	{
+		WrittenFiles.Enqueue(FWrittenFile{ FilePath, NumBytes });
+	}
+
+	/**
+	 * Records frames of files written since the last call,
+	 * mapping the rig camera directories the files are written to onto camera names
+	 * Returns the number of newly recorded frames
+	*/
+	int32 RecordWrittenFrames(const TMap<FString, FString>& CameraDirNames);
+
+	/** Marks the target of the camera as fully rendered */
+	void MarkComplete(const FString& CameraName, const FString& OutputName);
+
+	/** Checks if the target of the camera is fully rendered */
+	bool IsComplete(const FString& CameraName, const FString& OutputName) const;
+
+	/** Returns the number of recorded frames of the target of the camera inside the range */
+	int32 NumRenderedFrames(
+		const FString& CameraName,
+		const FString& OutputName,
+		const TRange<int32>& FrameRange) const;
+
+	/** Returns the number of image files recorded since the manifest was opened */
+	int64 NumRecordedFiles() const { return RecordedFiles; }
+
+	/** Returns the total size of image files recorded since the manifest was opened */
+	int64 NumRecordedBytes() const { return RecordedBytes; }
+
+	/** Returns the smallest range containing all frames of the range that are not rendered yet */
+	TRange<int32> MissingFrameRange(
+		const FString& CameraName,
+		const FString& OutputName,
+		const TRange<int32>& FrameRange) const;
+
+	/** Parses the sequence frame number from the output image file name */
+	static bool ParseFrameNumber(const FString& FileName, int32& OutFrameNumber);
+
+	/** Clean name of the manifest file */
+	static const FString ManifestFileName;
+
+	/** Marker written in place of the frame number once a target is complete */
+	static const FString CompleteMarker;
+
+private:
+	/** Key of the camera and target pair */
+	static FString Key(const FString& CameraName, const FString& OutputName)
+	{
+		return CameraName / OutputName;
+	}
+
+	/** Appends lines to the manifest file */
+	void AppendLines(const TArray<FString>& Lines);
+
+	/** Path to the manifest file */
+	FString ManifestFilePath;
+
+	/** Rendered frames of each camera and target pair */
+	TMap<FString, TSet<int32>> RenderedFrames;
+
+	/** Fully rendered camera and target pairs */
+	TSet<FString> CompletedOutputs;
+
+	/** Number of image files recorded since the manifest was opened */
+	int64 RecordedFiles;
+
+	/** Total size of image files recorded since the manifest was opened */
+	int64 RecordedBytes;
+
+	/** File written by an image write task and its size */
+	struct FWrittenFile
+	{
+		FString FilePath;
+		int64 NumBytes;
+	};
+
+	/** Files written since they were last recorded, filled by the image write threads */
+	static TQueue<FWrittenFile, EQueueMode::Mpsc> WrittenFiles;
+};
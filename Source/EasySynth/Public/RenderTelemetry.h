@@ -0,0 +1,132 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IImageWrapper.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+
+/**
+ * Traces the enclosing scope as an Unreal Insights CPU event
+ * and records its duration as a sample of the render stage
+*/
+#define EASYSYNTH_STAGE_SCOPE(StageName) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*FString(StageName)); \
+	FRenderTelemetry::FStageScope ANONYMOUS_VARIABLE(EasySynthStageScope)(StageName)
+
+
+/**
+ * Class that accumulates durations of render stages during a rendering run
+ * and exports them as a CSV timing report
+ * Samples can be added from any thread, as images are written by worker threads
+*/
+class FRenderTelemetry
+{
+public:
+	/** Returns the telemetry shared by the renderer and the image writers */
+	static FRenderTelemetry& Get();
+
+	/** Removes samples of the previous run */
+	void Reset();
+
+	/** Adds a duration sample of the stage, with the number of bytes and frames it produced */
+	void AddSample(const FString& StageName, const double Seconds, const int64 Bytes = 0, const int64 Frames = 0);
+
+	/** Writes accumulated stage timings into the CSV file inside the output directory */
+	bool ExportTimings(const FString& OutputDirectory) const;
+
+	/**
+	 * Merges timing reports of renderings split between processes into the report inside the output directory,
+	 * adding up samples of the same stage
+	*/
+	static bool MergeTimings(const TArray<FString>& FilePaths, const FString& OutputDirectory);
+
+	/** Measured cost of rendering a single frame of a target */
+	struct FFrameCost
+	{
+		/** Mean time needed to render a frame */
+		double SecondsPerFrame = 0.0;
+
+		/** Mean size of a written image file per image pixel */
+		double BytesPerPixel = 0.0;
+	};
+
+	/**
+	 * Appends a finished pipeline job to the render history of the project,
+	 * with the number and the size of image files it wrote
+	*/
+	static bool AppendHistory(
+		const FString& TargetName,
+		const EImageFormat ImageFormat,
+		const FIntPoint& Resolution,
+		const int32 NumFrames,
+		const double Seconds,
+		const int64 NumFiles,
+		const int64 NumBytes);
+
+	/**
+	 * Reads the render history of the project and returns the frame cost of each target and output format,
+	 * keyed by their job name
+	 * Render times are taken from jobs of the same resolution when available
+	*/
+	static bool LoadFrameCosts(const FIntPoint& Resolution, TMap<FString, FFrameCost>& OutFrameCosts);
+
+	/** Name of the pipeline job rendering the target in the output format, used by the stage timings and the frame costs */
+	static FString JobName(const FString& TargetName, const EImageFormat ImageFormat)
+	{
+		return TargetName / ImageFormatName(ImageFormat);
+	}
+
+	/** Lowercase name of the output image format */
+	static FString ImageFormatName(const EImageFormat ImageFormat);
+
+	/** Prefix of the stage names measuring pipeline jobs, followed by the job name */
+	static const FString RenderJobStagePrefix;
+
+	/** Measures the lifetime of the scope object and adds it as a stage sample */
+	class FStageScope
+	{
+	public:
+		explicit FStageScope(const FString& StageName) :
+			StageName(StageName),
+			StartTime(FPlatformTime::Seconds())
+		{}
+
+		~FStageScope() { FRenderTelemetry::Get().AddSample(StageName, FPlatformTime::Seconds() - StartTime); }
+
+	private:
+		/** Name of the measured stage */
+		const FString StageName;
+
+		/** Time at which the scope was entered */
+		const double StartTime;
+	};
+
+private:
+	/** Accumulated samples of a single stage */
+	struct FStageTimings
+	{
+		int32 Count = 0;
+		double TotalSeconds = 0.0;
+		double MinSeconds = TNumericLimits<double>::Max();
+		double MaxSeconds = 0.0;
+		int64 TotalBytes = 0;
+		int64 TotalFrames = 0;
+	};
+
+	/** Returns the accumulated samples of the stage, adding the stage if it has none, must be called under the lock */
+	FStageTimings& FindOrAddStage(const FString& StageName);
+
+	/** Accumulated samples of each stage */
+	TMap<FString, FStageTimings> Stages;
+
+	/** Names of the stages in the order of first appearance, as the report lists them */
+	TArray<FString> StageNames;
+
+	/** Guards stages against concurrent updates */
+	mutable FCriticalSection StagesCriticalSection;
+
+	/** Header line of the render history file */
+	static const FString HistoryHeader;
+};
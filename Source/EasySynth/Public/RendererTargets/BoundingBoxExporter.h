@@ -0,0 +1,112 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "LevelSequence.h"
+
+#include "RendererTargets/ObjectPoseExporter.h"
+#include "RendererTargets/SequenceFrameEvaluator.h"
+#include "SequencerWrapper.h"
+
+class UCameraComponent;
+class UTextureStyleManager;
+
+
+/**
+ * Class which instance is used to export bounding boxes of actors with a semantic class.
+ * For each frame, the oriented 3D box of each actor and its 2D box inside each rig camera are written
+ * as a NumPy structured array file per rig camera, next to a table describing the actors.
+ * An object of this class should be discarded when its job is done
+*/
+class FBoundingBoxExporter
+{
+public:
+	FBoundingBoxExporter() : FrameRange(TRange<int32>::All()) {}
+
+	/** Restricts the export to sequence display frames inside the range */
+	void SetFrameRange(const TRange<int32>& Range) { FrameRange = Range; }
+
+	/**
+	 * Export bounding boxes of labeled actors for each rendered frame, evaluating the sequence frame by frame
+	 * 2D boxes are projected using the intrinsics exported inside the camera rig file
+	 */
+	bool ExportBoundingBoxes(
+		ULevelSequence* LevelSequence,
+		const FIntPoint OutputImageResolution,
+		const FString& OutputDir,
+		const TArray<UCameraComponent*>& RigCameras,
+		const UTextureStyleManager* TextureStyleManager);
+
+private:
+	/** Actor with a semantic class */
+	struct FLabeledActor
+	{
+		/** The actor */
+		AActor* Actor;
+
+		/** Actor label, GUID and semantic class, as written into the actors table */
+		FObjectPoseExporter::FObjectDescription Description;
+
+		/** Bounds of the actor components inside the actor space */
+		FBox LocalBounds;
+	};
+
+	/** Record of a single box visible inside a camera, matching the data type of written files */
+	struct FBoundingBoxRecord
+	{
+		/** Sequence display frame number */
+		int32 Frame;
+
+		/** Id of the actor inside the actors table */
+		int32 Object;
+
+		/** World position of the 3D box center in centimeters */
+		double Center[3];
+
+		/** Half sizes of the 3D box along its axes in centimeters */
+		float Extent[3];
+
+		/** World rotation quaternion of the 3D box */
+		float Rotation[4];
+
+		/** Minimum and maximum image coordinates of the 2D box in pixels */
+		float Box2D[4];
+
+		/** Distance of the 3D box center in front of the camera in centimeters */
+		float Depth;
+	};
+
+	/** Finds actors with a semantic class and their local bounds */
+	bool FindLabeledActors(const UTextureStyleManager* TextureStyleManager);
+
+	/**
+	 * Projects the box corners into the camera image, clipping the box by the near plane,
+	 * returns false if the box is not visible inside the image
+	 */
+	static bool ProjectBox(
+		const FVector (&Corners)[8],
+		const FTransform& CameraTransform,
+		const TArray<double>& Intrinsics,
+		const FIntPoint& ImageResolution,
+		FBox2D& OutBox);
+
+	/** Sequencer wrapper needed to acces the level sequence properties */
+	FSequencerWrapper SequencerWrapper;
+
+	/** Actors whose boxes are exported, in the id order */
+	TArray<FLabeledActor> LabeledActors;
+
+	/** Exported frames */
+	FSequenceFrameEvaluator::FFrames Frames;
+
+	/** Range of sequence display frames to be exported */
+	TRange<int32> FrameRange;
+
+	/** Data type of written files, a structured array matching the box record */
+	static const FString RecordDataType;
+
+	/** Distance of the near plane boxes are clipped by in centimeters */
+	static const double NearPlaneDistance;
+};
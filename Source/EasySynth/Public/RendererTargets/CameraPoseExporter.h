@@ -9,6 +9,8 @@
 #include "SequencerWrapper.h"
 
 class UCameraComponent;
+class UMovieScene3DTransformTrack;
+class UMovieSceneCameraCutSection;
 
 
 /**
@@ -18,22 +20,83 @@ class UCameraComponent;
 class FCameraPoseExporter
 {
 public:
+	FCameraPoseExporter() : FrameRange(TRange<int32>::All()), bBatchedEvaluation(true) {}
+
+	/** Restricts the export to sequence display frames inside the range */
+	void SetFrameRange(const TRange<int32>& Range) { FrameRange = Range; }
+
+	/** Selects whether the transform track is evaluated for many frames at once, or frame by frame */
+	void SetBatchedEvaluation(const bool bBatched) { bBatchedEvaluation = bBatched; }
+
 	/**
-	 * Export camera poses from the sequence to a file,
-	 * to export rig poses, pass nullptr for the CameraComponent
+	 * Export rig poses from the sequence to a file, together with a file for each rig camera
+	 * The sequence is evaluated once, and poses of a rig camera are derived by accumulating the relative transform
+	 * the rendering camera takes while that rig camera is rendered, received at the same index
 	 */
 	bool ExportCameraPoses(
 		ULevelSequence* LevelSequence,
 		const FIntPoint OutputImageResolution,
 		const FString& OutputDir,
-		UCameraComponent* CameraComponent);
+		const TArray<UCameraComponent*>& RigCameras,
+		const TArray<FTransform>& RenderingCameraTransforms);
+
+	/**
+	 * Export rig IMU samples from the sequence to a file, evaluating the rig transform track at the sequence frames
+	 * and interpolating poses at the sample rate in between
+	 * Velocities and accelerations are computed by finite differences, and simulated gyroscope and
+	 * accelerometer readings get gaussian noise with the received standard deviations
+	 */
+	bool ExportImuSamples(
+		ULevelSequence* LevelSequence,
+		const FString& OutputDir,
+		const double SampleRateHz,
+		const double GyroNoise,
+		const double AccelNoise);
+
+	/**
+	 * Extracts poses of the sequence with both the batched and the per frame evaluation,
+	 * logs their durations and returns false if they do not produce identical poses
+	 * Returns false without extracting anything if the interrogation batch size is 1
+	 */
+	static bool BenchmarkPoseEvaluation(ULevelSequence* LevelSequence);
 
 private:
 	/** Extract camera transforms using the sequencer wrapper */
-	bool ExtractCameraTransforms(const bool bAccumulateCameraOffset);
+	bool ExtractCameraTransforms();
+
+	/** Finds the transform track of the camera bound to the cut section */
+	UMovieScene3DTransformTrack* FindCameraTransformTrack(UMovieSceneCameraCutSection* CutSection);
 
-	/** Saves the extracted camera poses to a file */
-	bool SavePosesToCSV(const FString& FilePath);
+	/** Evaluates the transform track at the ticks, importing the track again for each tick */
+	bool EvaluateTransformsPerFrame(
+		UMovieScene3DTransformTrack* TransformTrack,
+		const TConstArrayView<FFrameTime> TickNumbers,
+		TArray<FTransform>& OutTransforms);
+
+	/**
+	 * Interpolates the transforms of consecutive frames at the fractional frame position,
+	 * using a Catmull-Rom spline for the translation and a spherical spline for the rotation
+	 */
+	static FTransform InterpolateTransform(const TArray<FTransform>& Transforms, const double Position);
+
+	/** Returns a sample of the zero mean gaussian noise with the standard deviation */
+	static double GaussianNoise(FRandomStream& RandomStream, const double StandardDeviation);
+
+	/** Saves camera poses to a file */
+	bool SavePosesToCSV(const FString& FilePath, const TArray<FTransform>& Transforms) const;
+
+	/** Cut section camera and the number of consecutive extracted poses that belong to it */
+	struct FPoseSection
+	{
+		/** Camera bound to the cut section */
+		UCameraComponent* Camera;
+
+		/** Relative transform of the camera at the time of the extraction */
+		FTransform CameraTransform;
+
+		/** Number of extracted poses inside the cut section */
+		int32 NumPoses;
+	};
 
 	/** Sequencer wrapper needed to acces the level sequence properties */
 	FSequencerWrapper SequencerWrapper;
@@ -41,9 +104,24 @@ private:
 	/** Resolution of output images */
 	FIntPoint OutputResolution;
 
-	/** Extracted camera pose transforms */
+	/** Extracted camera pose transforms, without the relative transform of the camera */
 	TArray<FTransform> CameraTransforms;
 
+	/** Cut sections of the extracted poses, in order */
+	TArray<FPoseSection> PoseSections;
+
 	/** Frame timestamps */
 	TArray<double> Timestamps;
+
+	/** Range of sequence display frames to be exported */
+	TRange<int32> FrameRange;
+
+	/** Whether the transform track is evaluated for many frames at once */
+	bool bBatchedEvaluation;
+
+	/** Seed of the simulated IMU noise, combined with the sample index so that exports are reproducible */
+	static const int32 ImuNoiseSeed;
+
+	/** Standard gravity in meters per second squared */
+	static const double StandardGravity;
 };
@@ -26,6 +26,12 @@ public:
 	/** Returns the name of the target */
 	virtual FString Name() const { return TEXT("CustomPPMaterial"); }
 
+	/** Returns the texture style the target needs to be rendered with */
+	ETextureStyle TextureStyle() const override { return ETextureStyle::COLOR; }
+
+	/** Creates the post-process material that renders the target */
+	UMaterialInterface* CreatePostProcessMaterial() override;
+
 	/** Prepares the sequence for rendering the target */
 	bool PrepareSequence(ULevelSequence* LevelSequence) override;
 
@@ -19,24 +19,50 @@ public:
 	explicit FDepthImageTarget(
 		UTextureStyleManager* TextureStyleManager,
 		const EImageFormat ImageFormat,
-		const float DepthRangeMeters) :
+		const float DepthRangeMeters,
+		const bool bDepthInMeters) :
 			FRendererTarget(TextureStyleManager, ImageFormat),
-			DepthRangeMeters(DepthRangeMeters)
+			DepthRangeMeters(DepthRangeMeters),
+			bDepthInMeters(bDepthInMeters)
 	{}
 
 	/** Returns the name of the target */
 	virtual FString Name() const { return TEXT("DepthImage"); }
 
+	/** Returns the texture style the target needs to be rendered with */
+	ETextureStyle TextureStyle() const override { return ETextureStyle::COLOR; }
+
+	/** Creates the post-process material that renders the target */
+	UMaterialInterface* CreatePostProcessMaterial() override;
+
 	/** Prepares the sequence for rendering the target */
 	bool PrepareSequence(ULevelSequence* LevelSequence) override;
 
 	/** Reverts changes made to the sequence by the PrepareSequence */
 	bool FinalizeSequence(ULevelSequence* LevelSequence) override;
 
+	/** Depth in meters is rendered as a separate full precision render pass */
+	TArray<UMaterialInterface*> RenderPassMaterials() const override;
+
+	/** Depth in meters is written as a single channel */
+	ERawImageOutput RawOutput() const override { return bDepthInMeters ? ERawImageOutput::DepthMeters : ERawImageOutput::None; }
+
 private:
+	/** Loads the movie pipeline material that outputs the linear scene depth in centimeters */
+	static UMaterialInterface* LoadWorldDepthMaterial();
+
 	/** The clipping range meters when rendering the depth target */
 	const float DepthRangeMeters;
 
+	/**
+	 * Whether the depth is written as unclamped float values in meters,
+	 * instead of being normalized by the depth range
+	*/
+	const bool bDepthInMeters;
+
+	/** Path to the movie pipeline world depth material */
+	static const FString WorldDepthMaterialPath;
+
 	/** The name of the depth range meters material parameter */
 	static const FString DepthRangeMetersParameter;
 };
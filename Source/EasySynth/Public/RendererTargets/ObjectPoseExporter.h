@@ -0,0 +1,93 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "LevelSequence.h"
+
+#include "RendererTargets/SequenceFrameEvaluator.h"
+#include "SequencerWrapper.h"
+
+class UMovieScene3DTransformTrack;
+class UTextureStyleManager;
+
+
+/**
+ * Class which instance is used to export poses of all objects bound to the sequence with a transform track.
+ * Poses are written as columns, a NumPy array file for each of them, next to a table describing the objects.
+ * An object of this class should be discarded when its job is done
+*/
+class FObjectPoseExporter
+{
+public:
+	FObjectPoseExporter() : FrameRange(TRange<int32>::All()) {}
+
+	/** Restricts the export to sequence display frames inside the range */
+	void SetFrameRange(const TRange<int32>& Range) { FrameRange = Range; }
+
+	/**
+	 * Export poses of bound objects for each rendered frame to the object poses directory,
+	 * together with the actor GUID and the semantic class of each object
+	 */
+	bool ExportObjectPoses(
+		ULevelSequence* LevelSequence,
+		const FString& OutputDir,
+		const UTextureStyleManager* TextureStyleManager);
+
+	/** Row of an objects table */
+	struct FObjectDescription
+	{
+		/** Name of the object */
+		FString Name;
+
+		/** GUID of the actor, zero if the object is not resolved to an actor */
+		FGuid ActorGuid;
+
+		/** Semantic class of the actor */
+		FString ClassName;
+	};
+
+	/** Saves the table of objects, ids of the objects are their indices */
+	static bool SaveObjectsToCSV(const FString& FilePath, const TArray<FObjectDescription>& Objects);
+
+private:
+	/** Finds objects bound with transform tracks and their actors */
+	bool FindPosedObjects(const UTextureStyleManager* TextureStyleManager);
+
+	/**
+	 * Evaluates transform tracks of all objects together, so that each interrogator update evaluates all objects
+	 * for the ticks of a batch, and appends each batch to the translation and rotation columns
+	 */
+	bool EvaluateAndSaveTransforms(FArchive& TranslationWriter, FArchive& RotationWriter);
+
+	/** Sequencer wrapper needed to acces the level sequence properties */
+	FSequencerWrapper SequencerWrapper;
+
+	/** Objects bound to the sequence with a transform track, in the column order */
+	TArray<FObjectDescription> PosedObjects;
+
+	/** Transform tracks of the posed objects */
+	TArray<UMovieScene3DTransformTrack*> TransformTracks;
+
+	/** Exported frames */
+	FSequenceFrameEvaluator::FFrames Frames;
+
+	/** Range of sequence display frames to be exported */
+	TRange<int32> FrameRange;
+
+	/** Clean name of the posed objects table */
+	static const FString ObjectsFileName;
+
+	/** Clean name of the frame number column */
+	static const FString FrameColumnFileName;
+
+	/** Clean name of the timestamp column */
+	static const FString TimestampColumnFileName;
+
+	/** Clean name of the translation column */
+	static const FString TranslationColumnFileName;
+
+	/** Clean name of the rotation column */
+	static const FString RotationColumnFileName;
+};
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "UObject/GCObject.h"
 
 #include "RendererTargets/RendererTarget.h"
 
@@ -13,30 +14,72 @@ class UTextureStyleManager;
  * Class responsible for updating the world properties before
  * the optical flow image target rendering and restoring them after the rendering
 */
-class FOpticalFlowImageTarget : public FRendererTarget
+class FOpticalFlowImageTarget : public FRendererTarget, public FGCObject
 {
 public:
 	explicit FOpticalFlowImageTarget(
 		UTextureStyleManager* TextureStyleManager,
 		const EImageFormat ImageFormat,
-		const float OpticalFlowScale) :
+		const float OpticalFlowScale,
+		const bool bOpticalFlowInPixels) :
 			FRendererTarget(TextureStyleManager, ImageFormat),
-			OpticalFlowScale(OpticalFlowScale)
+			OpticalFlowScale(OpticalFlowScale),
+			bOpticalFlowInPixels(bOpticalFlowInPixels),
+			PassMaterial(nullptr)
 	{}
 
 	/** Returns the name of the target */
 	virtual FString Name() const { return TEXT("OpticalFlowImage"); }
 
+	/** Returns the texture style the target needs to be rendered with */
+	ETextureStyle TextureStyle() const override { return ETextureStyle::COLOR; }
+
+	/** Creates the post-process material that renders the target */
+	UMaterialInterface* CreatePostProcessMaterial() override;
+
 	/** Prepares the sequence for rendering the target */
 	bool PrepareSequence(ULevelSequence* LevelSequence) override;
 
 	/** Reverts changes made to the sequence by PrepareSequence */
 	bool FinalizeSequence(ULevelSequence* LevelSequence) override;
 
+	/** Optical flow in pixels is rendered as a separate full precision render pass */
+	TArray<UMaterialInterface*> RenderPassMaterials() const override;
+
+	/** Optical flow in pixels is scaled from the rendered flow values while writing */
+	ERawImageOutput RawOutput() const override
+	{
+		return bOpticalFlowInPixels ? ERawImageOutput::OpticalFlowPixels : ERawImageOutput::None;
+	}
+
+	/** FGCObject interface, keeps the render pass material alive during rendering */
+	void AddReferencedObjects(FReferenceCollector& Collector) override;
+
+	/** FGCObject interface */
+	FString GetReferencerName() const override { return TEXT("FOpticalFlowImageTarget"); }
+
 private:
 	/** The scaling coefficient for increasing the saturation of optical flow images */
 	const float OpticalFlowScale;
 
+	/**
+	 * Whether optical flow is written as unscaled float vectors in pixels,
+	 * instead of color-coded images
+	*/
+	const bool bOpticalFlowInPixels;
+
+	/**
+	 * Creates the post-process material that renders unencoded optical flow vectors,
+	 * with the image scaled to a 1.0 x 1.0 square
+	*/
+	static UMaterialInterface* CreateFlowValuesMaterial();
+
+	/** Post-process material rendered as the render pass when writing optical flow in pixels */
+	UMaterialInterface* PassMaterial;
+
+	/** HLSL code of the flow values material */
+	static const FString FlowValuesMaterialCode;
+
 	/** The name of the optical flow scale material parameter */
 	static const FString OpticalFlowScaleParameter;
 };
@@ -0,0 +1,26 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "RawImageOutput.generated.h"
+
+
+/**
+ * Raw values written by the EXR output instead of the rendered color
+ * Targets with raw outputs are rendered as separate full precision render passes,
+ * whose values are converted while the EXR file is written
+*/
+UENUM()
+enum class ERawImageOutput : uint8
+{
+	/** The rendered color is written as is */
+	None,
+
+	/** The first channel holds depth in centimeters, written as a single Y channel of depth in meters */
+	DepthMeters,
+
+	/** The first two channels hold optical flow relative to the image size, written as R and G channels of flow in pixels */
+	OpticalFlowPixels
+};
@@ -6,9 +6,12 @@
 #include "IImageWrapper.h"
 
 #include "PathUtils.h"
+#include "RendererTargets/RawImageOutput.h"
+#include "TextureStyles/TextureStyleManager.h"
 
 class UCameraComponent;
 class ULevelSequence;
+class UMaterialInterface;
 
 class UTextureStyleManager;
 
@@ -29,6 +32,33 @@ public:
 	/** Returns a name of a specific target */
 	virtual FString Name() const = 0;
 
+	/** Returns the texture style the target needs to be rendered with */
+	virtual ETextureStyle TextureStyle() const = 0;
+
+	/** Creates the post-process material that renders a specific target */
+	virtual UMaterialInterface* CreatePostProcessMaterial() = 0;
+
+	/**
+	 * Returns materials that should be rendered as separate pipeline render passes,
+	 * empty if the target is rendered through the camera post-process settings
+	*/
+	virtual TArray<UMaterialInterface*> RenderPassMaterials() const { return TArray<UMaterialInterface*>(); }
+
+	/**
+	 * Returns the raw values the target render pass is converted into while writing,
+	 * which is supported by the EXR output only
+	*/
+	virtual ERawImageOutput RawOutput() const { return ERawImageOutput::None; }
+
+	/**
+	 * Returns class colors if the target is written as class index images,
+	 * where the index of a color is the written pixel value, supported by the PNG output only
+	*/
+	virtual TArray<FColor> ClassIndexColors() const { return TArray<FColor>(); }
+
+	/** Returns names of output directories the target writes images into */
+	virtual TArray<FString> OutputNames() const { return TArray<FString>({ Name() }); }
+
 	/** Prepares the sequence for rendering a specific target */
 	virtual bool PrepareSequence(ULevelSequence* LevelSequence) = 0;
 
@@ -45,11 +75,10 @@ protected:
 	/** Removes renderer target specific post-process materials */
 	bool ClearCameraPostProcess(ULevelSequence* LevelSequence);
 
-	/** Returns the path to the specific target post process material */
+	/** Returns the specific target post process material */
 	inline UMaterial* LoadPostProcessMaterial() const
 	{
-		return DuplicateObject<UMaterial>(
-			LoadObject<UMaterial>(nullptr, *FPathUtils::PostProcessMaterialPath(Name())), nullptr);
+		return TextureStyleManager->PostProcessMaterial(Name());
 	}
 
 	/** Handle for managing texture style in the level */
@@ -16,16 +16,33 @@ class UTextureStyleManager;
 class FSemanticImageTarget : public FRendererTarget
 {
 public:
-	explicit FSemanticImageTarget(UTextureStyleManager* TextureStyleManager, const EImageFormat ImageFormat) :
-		FRendererTarget(TextureStyleManager, ImageFormat)
+	explicit FSemanticImageTarget(
+		UTextureStyleManager* TextureStyleManager,
+		const EImageFormat ImageFormat,
+		const bool bClassIndices) :
+			FRendererTarget(TextureStyleManager, ImageFormat),
+			bClassIndices(bClassIndices)
 	{}
 
 	/** Returns the name of the target */
 	virtual FString Name() const { return TEXT("SemanticImage"); }
 
+	/** Returns the texture style the target needs to be rendered with */
+	ETextureStyle TextureStyle() const override { return ETextureStyle::SEMANTIC; }
+
+	/** Creates the post-process material that renders the target */
+	UMaterialInterface* CreatePostProcessMaterial() override;
+
 	/** Prepares the sequence for rendering the target */
 	bool PrepareSequence(ULevelSequence* LevelSequence) override;
 
 	/** Reverts changes made to the sequence by the PrepareSequence */
 	bool FinalizeSequence(ULevelSequence* LevelSequence) override;
+
+	/** Returns semantic class colors in the order of exported semantic classes, if writing class indices */
+	TArray<FColor> ClassIndexColors() const override;
+
+private:
+	/** Whether semantic images are written as class indices instead of class colors */
+	const bool bClassIndices;
 };
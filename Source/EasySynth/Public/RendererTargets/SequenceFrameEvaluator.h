@@ -0,0 +1,55 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FSequencerWrapper;
+class UMovieScene3DTransformTrack;
+
+
+/**
+ * Helpers shared by exporters that evaluate the level sequence for each exported frame
+*/
+class FSequenceFrameEvaluator
+{
+public:
+	/** Frames covered by camera cut sections, in the cut section order */
+	struct FFrames
+	{
+		/** Ticks of the frames */
+		TArray<FFrameTime> TickNumbers;
+
+		/** Display frame numbers of the frames */
+		TArray<int32> FrameNumbers;
+
+		/** Frame timestamps, counted from the sequence start including frames outside of the range */
+		TArray<double> Timestamps;
+
+		/** Number of frames that belong to each cut section */
+		TArray<int32> SectionNumFrames;
+	};
+
+	/** Collects frames covered by cut sections of the opened sequence, skipping frames outside of the range */
+	static void CollectFrameTicks(FSequencerWrapper& SequencerWrapper, const TRange<int32>& FrameRange, FFrames& OutFrames);
+
+	/**
+	 * Evaluates transform tracks at the ticks, importing all tracks into the interrogator again for each batch of ticks,
+	 * holding up to InterrogationBatchSize ticks
+	 * Each batch is passed to the callback together with the index of its first tick,
+	 * as transforms of each track for all ticks of the batch, and a failed callback stops the evaluation
+	 */
+	static bool EvaluateTransformTracks(
+		const TArray<UMovieScene3DTransformTrack*>& TransformTracks,
+		const TConstArrayView<FFrameTime> TickNumbers,
+		TFunctionRef<bool(const int32 BatchStartIndex, const TArray<TArray<FTransform>>& TrackTransforms)> BatchCallback);
+
+	/** Evaluates a single transform track at the ticks, appending its transforms */
+	static bool EvaluateTransformTrack(
+		UMovieScene3DTransformTrack* TransformTrack,
+		const TConstArrayView<FFrameTime> TickNumbers,
+		TArray<FTransform>& OutTransforms);
+
+	/** Returns the maximum number of ticks evaluated by a single interrogator update */
+	static int32 InterrogationBatchSize();
+};
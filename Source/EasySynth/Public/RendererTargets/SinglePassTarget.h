@@ -0,0 +1,95 @@
+// Copyright (c) 2026 YDrive Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/GCObject.h"
+
+#include "RendererTargets/RendererTarget.h"
+
+class UTextureStyleManager;
+
+
+/**
+ * Class responsible for rendering multiple targets that share the texture style
+ * and the output format inside a single pipeline job, with each target being
+ * output as a separate post-process render pass named after the target
+ * Passes of a multilayer EXR target are written as named layers of a single file per frame
+*/
+class FSinglePassTarget : public FRendererTarget, public FGCObject
+{
+public:
+	explicit FSinglePassTarget(
+		UTextureStyleManager* TextureStyleManager,
+		const EImageFormat ImageFormat,
+		const ETextureStyle PassTextureStyle,
+		const bool bMultilayerExr) :
+			FRendererTarget(TextureStyleManager, ImageFormat),
+			PassTextureStyle(PassTextureStyle),
+			bMultilayerExr(bMultilayerExr && ImageFormat == EImageFormat::EXR)
+	{}
+
+	/** Returns the name of the target */
+	virtual FString Name() const;
+
+	/** Returns the texture style shared by all targets inside the pass */
+	ETextureStyle TextureStyle() const override { return PassTextureStyle; }
+
+	/** Single pass targets do not use the camera post-process material */
+	UMaterialInterface* CreatePostProcessMaterial() override { return nullptr; }
+
+	/** Prepares the sequence for rendering the target */
+	bool PrepareSequence(ULevelSequence* LevelSequence) override;
+
+	/** Reverts changes made to the sequence by the PrepareSequence */
+	bool FinalizeSequence(ULevelSequence* LevelSequence) override;
+
+	/** Returns post-process materials of all targets inside the pass */
+	TArray<UMaterialInterface*> RenderPassMaterials() const override { return PassMaterials; }
+
+	/**
+	 * Returns names of all targets inside the pass, as each one has its own output directory,
+	 * or only the pass name if all targets are written into the same multilayer files
+	*/
+	TArray<FString> OutputNames() const override;
+
+	/** Checks if all targets are written as layers of a single EXR file per frame */
+	bool MultilayerExr() const { return bMultilayerExr; }
+
+	/** Checks if the target can be rendered inside this pass */
+	bool AcceptsTarget(const TSharedPtr<FRendererTarget>& Target) const;
+
+	/** Adds a target to be rendered inside this pass */
+	void AddTarget(TSharedPtr<FRendererTarget> Target) { Targets.Add(Target); }
+
+	/** Returns the number of targets inside the pass */
+	int NumTargets() const { return Targets.Num(); }
+
+	/** Returns the first target inside the pass */
+	TSharedPtr<FRendererTarget> FirstTarget() const { return Targets[0]; }
+
+	/** FGCObject interface, keeps created pass materials alive during rendering */
+	void AddReferencedObjects(FReferenceCollector& Collector) override;
+
+	/** FGCObject interface */
+	FString GetReferencerName() const override { return TEXT("FSinglePassTarget"); }
+
+private:
+	/** Returns names of all targets inside the pass */
+	TArray<FString> TargetNames() const;
+
+	/** Creates a copy of the material that is named after the render pass */
+	static UMaterialInterface* CreatePassMaterial(UMaterialInterface* Material, const FString& PassName);
+
+	/** Texture style shared by all targets inside the pass */
+	const ETextureStyle PassTextureStyle;
+
+	/** Whether all targets are written as layers of a single EXR file per frame */
+	const bool bMultilayerExr;
+
+	/** Targets rendered inside the pass */
+	TArray<TSharedPtr<FRendererTarget>> Targets;
+
+	/** Post-process materials of the targets, ordered as the targets */
+	TArray<UMaterialInterface*> PassMaterials;
+};
@@ -4,6 +4,11 @@
 
 #include "CoreMinimal.h"
 
+#include "DatasetShardPacker.h"
+#include "ReadinessScheduler.h"
+#include "RenderCostEstimate.h"
+#include "RenderJobSpec.h"
+#include "RenderManifest.h"
 #include "RendererTargets/ColorImageTarget.h"
 #include "RendererTargets/CustomPPMaterialTarget.h"
 #include "RendererTargets/DepthImageTarget.h"
@@ -11,14 +16,18 @@
 #include "RendererTargets/OpticalFlowImageTarget.h"
 #include "RendererTargets/RendererTarget.h"
 #include "RendererTargets/SemanticImageTarget.h"
+#include "RendererTargets/SinglePassTarget.h"
 #include "TextureStyles/TextureStyleManager.h"
 
 #include "SequenceRenderer.generated.h"
 
 class ULevelSequence;
 class UMoviePipelineExecutorBase;
+class UMoviePipelineExecutorJob;
 class UMoviePipelinePrimaryConfig;
+class UMoviePipelineQueue;
 class UMoviePipelineQueueSubsystem;
+class FSequencerWrapper;
 
 
 /**
@@ -61,12 +70,30 @@ public:
 	/** Return should camera poses be exported */
 	bool ExportCameraPoses() const { return bExportCameraPoses; }
 
+	/** Updates should poses of objects bound to the sequence be exported */
+	void SetExportObjectPoses(const bool bValue) { bExportObjectPoses = bValue; }
+
+	/** Return should poses of objects bound to the sequence be exported */
+	bool ExportObjectPoses() const { return bExportObjectPoses; }
+
+	/** Updates should bounding boxes of actors with a semantic class be exported */
+	void SetExportBoundingBoxes(const bool bValue) { bExportBoundingBoxes = bValue; }
+
+	/** Return should bounding boxes of actors with a semantic class be exported */
+	bool ExportBoundingBoxes() const { return bExportBoundingBoxes; }
+
 	/** DepthRangeMetersValue setter */
 	void SetDepthRangeMeters(const float DepthRangeMeters) { DepthRangeMetersValue = DepthRangeMeters; }
 
 	/** DepthRangeMetersValue getter */
 	float DepthRangeMeters() const { return DepthRangeMetersValue; }
 
+	/** Updates should depth be written as float values in meters */
+	void SetDepthInMeters(const bool bValue) { bDepthInMeters = bValue; }
+
+	/** Return should depth be written as float values in meters */
+	bool DepthInMeters() const { return bDepthInMeters; }
+
 	/** CustomPostProcessMaterialAssetData setter */
 	void SetCustomPPMaterialAssetData(const FAssetData& CustomPPMaterialAssetData);
 
@@ -79,6 +106,72 @@ public:
 	/** OpticalFlowScaleValue setter */
 	float OpticalFlowScale() const { return OpticalFlowScaleValue; }
 
+	/** Updates should optical flow be written as float vectors in pixels */
+	void SetOpticalFlowInPixels(const bool bValue) { bOpticalFlowInPixels = bValue; }
+
+	/** Return should optical flow be written as float vectors in pixels */
+	bool OpticalFlowInPixels() const { return bOpticalFlowInPixels; }
+
+	/** Updates should semantic images be written as class indices */
+	void SetSemanticClassIndices(const bool bValue) { bSemanticClassIndices = bValue; }
+
+	/** Return should semantic images be written as class indices */
+	bool SemanticClassIndices() const { return bSemanticClassIndices; }
+
+	/** Updates should EXR targets be written as layers of a single file per frame */
+	void SetMultilayerExr(const bool bValue) { bMultilayerExr = bValue; }
+
+	/** Return should EXR targets be written as layers of a single file per frame */
+	bool MultilayerExr() const { return bMultilayerExr; }
+
+	/** DatasetShardSizeMegabytesValue setter */
+	void SetDatasetShardSizeMegabytes(const int32 Megabytes) { DatasetShardSizeMegabytesValue = Megabytes; }
+
+	/** DatasetShardSizeMegabytesValue getter */
+	int32 DatasetShardSizeMegabytes() const { return DatasetShardSizeMegabytesValue; }
+
+	/** ImuRateHzValue setter */
+	void SetImuRateHz(const float RateHz) { ImuRateHzValue = RateHz; }
+
+	/** ImuRateHzValue getter */
+	float ImuRateHz() const { return ImuRateHzValue; }
+
+	/** ImuGyroNoiseValue setter */
+	void SetImuGyroNoise(const float GyroNoise) { ImuGyroNoiseValue = GyroNoise; }
+
+	/** ImuGyroNoiseValue getter */
+	float ImuGyroNoise() const { return ImuGyroNoiseValue; }
+
+	/** ImuAccelNoiseValue setter */
+	void SetImuAccelNoise(const float AccelNoise) { ImuAccelNoiseValue = AccelNoise; }
+
+	/** ImuAccelNoiseValue getter */
+	float ImuAccelNoise() const { return ImuAccelNoiseValue; }
+
+	/** Updates should compatible targets be rendered inside a single pass */
+	void SetSinglePassRendering(const bool bValue) { bSinglePassRendering = bValue; }
+
+	/** Return should compatible targets be rendered inside a single pass */
+	bool SinglePassRendering() const { return bSinglePassRendering; }
+
+	/** Updates should all rig cameras be rendered by a single pipeline job for each target */
+	void SetParallelRigRendering(const bool bValue) { bParallelRigRendering = bValue; }
+
+	/** Return should all rig cameras be rendered by a single pipeline job for each target */
+	bool ParallelRigRendering() const { return bParallelRigRendering; }
+
+	/** Updates should frames rendered by a previous run be skipped */
+	void SetResumeRendering(const bool bValue) { bResumeRendering = bValue; }
+
+	/** Return should frames rendered by a previous run be skipped */
+	bool ResumeRendering() const { return bResumeRendering; }
+
+	/** ReadinessTimeoutValue setter */
+	void SetReadinessTimeout(const float ReadinessTimeout) { ReadinessTimeoutValue = ReadinessTimeout; }
+
+	/** ReadinessTimeoutValue getter */
+	float ReadinessTimeout() const { return ReadinessTimeoutValue; }
+
 	/** Populate provided queue with selected renderer targets */
 	void GetSelectedTargets(
 		UTextureStyleManager* TextureStyleManager,
@@ -97,12 +190,24 @@ private:
 	/** Whether to export camera poses */
 	bool bExportCameraPoses;
 
+	/** Whether to export poses of all objects bound to the sequence with a transform track */
+	bool bExportObjectPoses;
+
+	/** Whether to export 3D and 2D bounding boxes of all actors with a semantic class */
+	bool bExportBoundingBoxes;
+
 	/**
 	 * The clipping range when rendering the depth target
 	 * Larger values provide the longer range, but also the lower granularity
 	*/
 	float DepthRangeMetersValue;
 
+	/**
+	 * Whether depth is written as a single float32 EXR channel of linear depth in meters,
+	 * which ignores the depth range
+	*/
+	bool bDepthInMeters;
+
 	/** Currently selected custom post process material asset data */
 	FAssetData CustomPostProcessMaterialAssetData;
 
@@ -112,6 +217,64 @@ private:
 	*/
 	float OpticalFlowScaleValue;
 
+	/**
+	 * Whether optical flow is written as two float32 EXR channels of flow in pixels,
+	 * which ignores the optical flow scale
+	*/
+	bool bOpticalFlowInPixels;
+
+	/**
+	 * Whether semantic images are written as single channel PNG images of class indices,
+	 * 8-bit for up to 256 classes and 16-bit otherwise
+	*/
+	bool bSemanticClassIndices;
+
+	/**
+	 * Whether EXR targets sharing the texture style are rendered by a single job
+	 * and written as named layers of a single EXR file per frame, regardless of the single pass rendering
+	*/
+	bool bMultilayerExr;
+
+	/**
+	 * Size of tar shards the rendered images and camera poses are packed into once the rendering succeeds,
+	 * zero keeps a separate file for each frame of each target
+	*/
+	int32 DatasetShardSizeMegabytesValue;
+
+	/**
+	 * Rate of rig pose and simulated IMU samples exported independently of the sequence frame rate,
+	 * zero disables the IMU export
+	*/
+	float ImuRateHzValue;
+
+	/** Standard deviation of the simulated gyroscope noise in radians per second */
+	float ImuGyroNoiseValue;
+
+	/** Standard deviation of the simulated accelerometer noise in meters per second squared */
+	float ImuAccelNoiseValue;
+
+	/**
+	 * Whether targets sharing the texture style and the output format
+	 * should be rendered as separate render passes of a single job
+	*/
+	bool bSinglePassRendering;
+
+	/**
+	 * Whether all rig cameras should be rendered as views of a single pipeline job for each target,
+	 * instead of running the pipeline once for each camera and target
+	 * Compatible targets are then always rendered inside a single pass, so the rig renders as few jobs as possible
+	*/
+	bool bParallelRigRendering;
+
+	/** Whether frames recorded in the render manifest of a previous run should be skipped */
+	bool bResumeRendering;
+
+	/**
+	 * Maximum time in seconds to wait for the engine to finish compiling and streaming
+	 * before starting the next rendering job
+	*/
+	float ReadinessTimeoutValue;
+
 	/** Default value for the depth range */
 	static const float DefaultDepthRangeMetersValue;
 
@@ -120,6 +283,75 @@ private:
 };
 
 
+/**
+ * Progress of the running sequence rendering
+ * Frames are counted for each rig camera and target separately
+*/
+USTRUCT(BlueprintType)
+struct FRenderProgress
+{
+	GENERATED_BODY()
+
+	/** Index of the rig camera currently being rendered */
+	UPROPERTY(BlueprintReadOnly, Category = "EasySynth")
+	int32 CameraIndex = 0;
+
+	/** Number of cameras inside the rig */
+	UPROPERTY(BlueprintReadOnly, Category = "EasySynth")
+	int32 NumCameras = 0;
+
+	/** Name of the target currently being rendered */
+	UPROPERTY(BlueprintReadOnly, Category = "EasySynth")
+	FString TargetName;
+
+	/** Number of rendered frames, including ones rendered by a resumed run */
+	UPROPERTY(BlueprintReadOnly, Category = "EasySynth")
+	int32 FramesCompleted = 0;
+
+	/** Total number of frames to be rendered */
+	UPROPERTY(BlueprintReadOnly, Category = "EasySynth")
+	int32 FramesTotal = 0;
+
+	/** Frames rendered per second since the start of the run */
+	UPROPERTY(BlueprintReadOnly, Category = "EasySynth")
+	float FramesPerSecond = 0.0f;
+
+	/** Megabytes of images written per second since the start of the run */
+	UPROPERTY(BlueprintReadOnly, Category = "EasySynth")
+	float MegabytesPerSecond = 0.0f;
+
+	/** Estimated time in seconds until the run finishes, negative while unknown */
+	UPROPERTY(BlueprintReadOnly, Category = "EasySynth")
+	float EtaSeconds = -1.0f;
+
+	/** Describes the progress in a single line */
+	FString ToString() const;
+};
+
+
+/** Delegate type used to broadcast the rendering progress to Blueprints and Python */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRenderProgressDelegate, const FRenderProgress&, Progress);
+
+
+/**
+ * Describes the rendering of a single level sequence inside the render queue
+*/
+struct FSequenceRenderJob
+{
+	/** Level sequence to be rendered */
+	FAssetData LevelSequenceAssetData;
+
+	/** Rendering options of the sequence */
+	FRendererTargetOptions TargetOptions;
+
+	/** Output image resolution */
+	FIntPoint OutputResolution;
+
+	/** Directory the sequence outputs are written into */
+	FString OutputDirectory;
+};
+
+
 /**
  * Class that runs sequence rendering
 */
@@ -142,9 +374,60 @@ public:
 		const FIntPoint OutputImageResolution,
 		const FString& OutputDirectory);
 
+	/**
+	 * Estimates the output size and the rendering time of the sequence without rendering it,
+	 * returns false if the sequence or its camera rig are not valid
+	 * Frames are counted from camera cut sections inside the frame range set by SetFrameRange
+	*/
+	bool EstimateRenderCost(
+		const FAssetData& LevelSequenceAssetData,
+		const FRendererTargetOptions& RenderingTargets,
+		const FIntPoint OutputImageResolution,
+		const FString& OutputDirectory,
+		FRenderCostEstimate& OutEstimate);
+
+	/**
+	 * Adds sequences to the persistent render queue and starts rendering them one after another,
+	 * returns false if the queue could not be updated
+	 * A failed sequence is recorded inside the queue file and the rendering proceeds with the next one
+	*/
+	bool RenderSequences(const TArray<FSequenceRenderJob>& Jobs);
+
+	/** Continues rendering sequences left inside the render queue by an interrupted session */
+	bool ResumeRenderQueue() { return RenderSequences(TArray<FSequenceRenderJob>()); }
+
+	/** Sets the render queue JSON file, cannot be changed while the queue is being processed */
+	void SetRenderQueueFilePath(const FString& FilePath);
+
+	/** Checks if the render queue is currently being processed */
+	bool IsProcessingQueue() const { return bProcessingQueue; }
+
+	/**
+	 * Sets the ROS JSON camera rig file used to override transforms and intrinsics
+	 * of the sequence rig cameras, an empty path keeps the rig unchanged
+	*/
+	void SetCameraRigOverride(const FString& CameraRigFilePath) { CameraRigOverridePath = CameraRigFilePath; }
+
+	/**
+	 * Restricts rendering to sequence display frames inside the range,
+	 * an unbounded range renders the whole sequence
+	*/
+	void SetFrameRange(const TRange<int32>& Range) { FrameRange = Range; }
+
 	/** Checks if the rendering is currently in progress */
 	bool IsRendering() const { return bCurrentlyRendering; }
 
+	/** Returns the latest progress of the running rendering */
+	UFUNCTION(BlueprintCallable, Category = "EasySynth")
+	FRenderProgress GetRenderProgress() const { return RenderProgress; }
+
+	/** Returns the renderer used by the plugin UI, so that scripts can follow its progress */
+	UFUNCTION(BlueprintCallable, Category = "EasySynth")
+	static USequenceRenderer* GetEditorSequenceRenderer();
+
+	/** Name of the renderer object used by the plugin UI */
+	static const FName EditorRendererName;
+
 	/** Returns the latest error message */
 	const FString& GetErrorMessage() const { return ErrorMessage; }
 
@@ -154,10 +437,36 @@ public:
 	/** Returns a reference to the event for others to bind */
 	FRenderingFinishedEvent& OnRenderingFinished() { return RenderingFinishedEvent; }
 
+	/** Delegate type used to broadcast the render queue finished event, carrying the number of failed sequences */
+	DECLARE_EVENT_OneParam(USequenceRenderer, FQueueFinishedEvent, int);
+
+	/** Returns a reference to the event for others to bind */
+	FQueueFinishedEvent& OnQueueFinished() { return QueueFinishedEvent; }
+
+	/** Delegate type used to broadcast the rendering progress event */
+	DECLARE_EVENT_OneParam(USequenceRenderer, FRenderProgressEvent, const FRenderProgress&);
+
+	/** Returns a reference to the event for others to bind */
+	FRenderProgressEvent& OnRenderProgress() { return RenderProgressEvent; }
+
+	/** Rendering progress event for Blueprint and Python handlers, broadcast along with OnRenderProgress */
+	UPROPERTY(BlueprintAssignable, Category = "EasySynth")
+	FRenderProgressDelegate RenderProgressDelegate;
+
 private:
+	/** Opens the sequence and finds cameras of the actor bound to its camera cuts */
+	bool FindRigCameras(
+		ULevelSequence* LevelSequence,
+		FSequencerWrapper& SequencerWrapper,
+		AActor*& OutCameraRigActor,
+		TArray<UCameraComponent*>& OutRigCameras);
+
 	/** Movie rendering finished handle */
 	void OnExecutorFinished(UMoviePipelineExecutorBase* InPipelineExecutor, bool bSuccess);
 
+	/** Movie rendering job started handle, prepares the rig camera and the target of the job */
+	void OnIndividualJobStarted(UMoviePipelineExecutorJob* StartedJob);
+
 	/** Handles finding the next rig camera to be used for rendering all requested targets */
 	void FindNextCamera();
 
@@ -167,15 +476,126 @@ private:
 	/** Runs the rendering of the currently selected target */
 	void StartRendering();
 
+	/**
+	 * Returns the frame range to be rendered for the target and the rig camera, empty if all are rendered
+	 * INDEX_NONE covers frames missing from any of the rig cameras
+	*/
+	TRange<int32> JobFrameRange(const TSharedPtr<FRendererTarget>& Target, const int RigCameraId) const;
+
+	/** Records frames whose images were written inside the render manifest, completing the current job outputs once it finishes */
+	void RecordRenderedFrames(const bool bJobFinished);
+
+	/** Records frames written since the last update and broadcasts the progress, called periodically during rendering */
+	void UpdateProgress();
+
+	/** Updates the progress using the render manifest and broadcasts it */
+	void BroadcastProgress();
+
+	/** Counts frames of all cameras and targets recorded inside the render manifest */
+	int32 CountRenderedFrames() const;
+
+	/** Prepares the sequence for rendering the target, recording the stage timing */
+	bool PrepareTarget(const TSharedPtr<FRendererTarget>& Target);
+
+	/** Reverts the target changes to the sequence, recording the stage timing */
+	bool FinalizeTarget(const TSharedPtr<FRendererTarget>& Target);
+
+	/** Marks the start of the pipeline job rendering the number of frames of the target */
+	void StartJobTiming(const TSharedPtr<FRendererTarget>& Target, const int32 NumFrames);
+
+	/**
+	 * Records the duration and the output size of the running pipeline job, if any,
+	 * adding a succeeded job to the render history
+	*/
+	void FinishJobTiming(const bool bJobSucceeded);
+
+	/** Exports poses of the whole rig and of each rig camera */
+	bool ExportCameraPoses();
+
+	/** Exports rig IMU samples at the selected sample rate */
+	bool ExportImuSamples();
+
+	/** Exports poses of objects bound to the sequence */
+	bool ExportObjectPoses();
+
+	/** Exports bounding boxes of labeled actors inside each rig camera */
+	bool ExportBoundingBoxes();
+
+	/** Applies the camera rig override file to the rig cameras, remembering their original state */
+	bool ApplyCameraRigOverride();
+
+	/** Restores transforms and fields of view the rig cameras had before the camera rig override */
+	void RestoreCameraRigOverride();
+
+	/** Binds all rig cameras to the sequence and starts rendering targets missing from any of them */
+	void StartRigRendering();
+
+	/** Prepares the next target and renders it using all rig cameras once the engine is ready */
+	void RenderNextRigTarget();
+
+	/**
+	 * Adds a binding named after its output directory for each rig camera,
+	 * so that the pipeline renders all of them as views of the same job
+	*/
+	bool BindRigCameras();
+
+	/** Removes the rig camera bindings added to the sequence */
+	void UnbindRigCameras();
+
+	/** Transfers the transform of the rig camera to the first one that is used for rendering */
+	void SelectRigCamera(const int RigCameraId);
+
 	/** Clears the existing job queue and adds a fresh job */
 	bool PrepareJobQueue(UMoviePipelineQueueSubsystem* MoviePipelineQueueSubsystem);
 
+	/** Updates the pipeline config to render the target using the rig camera, or all bound rig cameras for INDEX_NONE */
+	bool ConfigurePipeline(
+		UMoviePipelinePrimaryConfig* PipelineConfig,
+		const TSharedPtr<FRendererTarget>& Target,
+		const int RigCameraId);
+
+	/** Removes all jobs from the queue, returns null on failure */
+	UMoviePipelineQueue* ClearJobQueue(UMoviePipelineQueueSubsystem* MoviePipelineQueueSubsystem);
+
+	/** Adds a job that renders the sequence using the current config, returns null on failure */
+	UMoviePipelineExecutorJob* AddJob(UMoviePipelineQueue* MoviePipelineQueue);
+
+	/** Runs all jobs inside the queue */
+	bool RunJobQueue(UMoviePipelineQueueSubsystem* MoviePipelineQueueSubsystem);
+
+	/** Starts packing rendered images and camera poses of all rig cameras into dataset shards as they are written */
+	bool StartDatasetShards();
+
+	/** Stops packing written images and finishes the dataset shards */
+	bool FinishDatasetShards();
+
 	/** Finalizes rendering and broadcasts the event */
-	void BroadcastRenderingFinished(const bool bSuccess);
+	void BroadcastRenderingFinished(bool bSuccess);
+
+	/** Starts rendering the next pending render queue entry, or finishes the queue processing */
+	void RenderNextQueueEntry();
+
+	/** Starts rendering the sequence described by the queue entry */
+	bool StartQueueEntry(const FRenderJobSpec& Job);
+
+	/** Records the result of the current queue entry and schedules the next one */
+	void FinishQueueEntry(const bool bSuccess);
+
+	/** Loads the render queue file, dropping entries finished by previous sessions */
+	bool LoadRenderQueue();
+
+	/** Saves the render queue file */
+	bool SaveRenderQueue();
 
 	/** Rendering finished event dispatcher */
 	FRenderingFinishedEvent RenderingFinishedEvent;
 
+	/** Render queue finished event dispatcher */
+	FQueueFinishedEvent QueueFinishedEvent;
+
+	/** Rendering progress event dispatcher */
+	FRenderProgressEvent RenderProgressEvent;
+
 	/** Default movie pipeline config file provided with the plugin content */
 	UPROPERTY()
 	UMoviePipelinePrimaryConfig* EasySynthMoviePipelineConfig;
@@ -210,7 +630,7 @@ private:
 	/** Keeps the original camera field of view so it can be restored at the end */
 	double OriginalCameraFOV;
 
-	/** Keeps the currently selected rig camera */
+	/** Keeps the currently selected rig camera, INDEX_NONE while all rig cameras are rendered at once */
 	int CurrentRigCameraId;
 
 	/** Queue of targets to be rendered */
@@ -219,6 +639,89 @@ private:
 	/** Target currently being rendered */
 	TSharedPtr<FRendererTarget> CurrentTarget;
 
+	/** Sequence bindings of the rig cameras added for the rig rendering, empty outside of it */
+	TArray<FGuid> RigCameraBindings;
+
+	/** Executor running the current pipeline jobs */
+	UPROPERTY()
+	UMoviePipelineExecutorBase* ActiveExecutor;
+
+	/** Camera rig file overriding the rig cameras */
+	FString CameraRigOverridePath;
+
+	/** Rig cameras changed by the camera rig override */
+	UPROPERTY()
+	TArray<UCameraComponent*> OverriddenCameras;
+
+	/** Relative transforms of the overridden cameras before the override */
+	TArray<FTransform> OverriddenCameraTransforms;
+
+	/** Fields of view of the overridden cameras before the override */
+	TArray<double> OverriddenCameraFOVs;
+
+	/** Range of sequence display frames to be rendered */
+	TRange<int32> FrameRange;
+
+	/** Requested frame range limited to the sequence playback range */
+	TRange<int32> RenderFrameRange;
+
+	/** Tracks rendered frames to allow resuming */
+	FRenderManifest RenderManifest;
+
+	/** Handle for a timer updating the render manifest and the progress during rendering */
+	FTimerHandle ProgressTimerHandle;
+
+	/** Time between two consecutive progress updates */
+	static const float ProgressUpdateIntervalSeconds;
+
+	/** Latest rendering progress */
+	FRenderProgress RenderProgress;
+
+	/** Output names of each rendered target, used to count rendered frames */
+	TArray<TArray<FString>> ProgressTargetOutputs;
+
+	/** Packs written images into dataset shards, null unless packing is requested */
+	TSharedPtr<FDatasetShardPacker> DatasetShardPacker;
+
+	/** Number of frames already rendered when the run started */
+	int32 InitialFramesCompleted;
+
+	/** Content of the persistent render queue */
+	FRenderQueueContent RenderQueue;
+
+	/** Path to the render queue JSON file */
+	FString RenderQueueFilePath;
+
+	/** Index of the render queue entry currently being rendered */
+	int CurrentQueueEntryId;
+
+	/** Number of render queue entries that failed while processing the queue */
+	int NumFailedQueueEntries;
+
+	/** Marks if the render queue is currently being processed */
+	bool bProcessingQueue;
+
+	/** Time at which the current run started */
+	double RenderStartTime;
+
+	/** Time at which the running pipeline job started */
+	double JobStartTime;
+
+	/** Name of the target rendered by the running pipeline job, empty if none is running */
+	FString RunningJobTargetName;
+
+	/** Output image format of the target rendered by the running pipeline job */
+	EImageFormat RunningJobImageFormat;
+
+	/** Number of frames rendered by the running pipeline job */
+	int32 RunningJobNumFrames;
+
+	/** Number of image files recorded by the render manifest before the running pipeline job started */
+	int64 JobStartRecordedFiles;
+
+	/** Size of image files recorded by the render manifest before the running pipeline job started */
+	int64 JobStartRecordedBytes;
+
 	/** Output image resolution */
 	FIntPoint OutputResolution;
 
@@ -228,9 +731,15 @@ private:
 	/** Marks if rendering is currently in process */
 	bool bCurrentlyRendering;
 
-	/** Handle for a timer needed to make a brief pause between targets */
-	FTimerHandle RendererPauseTimerHandle;
+	/** Delays the start of rendering until the engine is ready */
+	FReadinessScheduler ReadinessScheduler;
 
 	/** Stores the latest error message */
 	FString ErrorMessage;
+
+	/** Output file name format of the default movie pipeline config */
+	FString DefaultFileNameFormat;
+
+	/** Whether the default movie pipeline config writes multilayer EXR files */
+	bool bDefaultExrMultilayer;
 };
@@ -41,6 +41,15 @@ public:
 	/** Access the movie scene cut sections */
 	TArray<UMovieSceneCameraCutSection*>& GetMovieSceneCutSections();
 
+	/** Returns the range of display frames covered by the sequence playback range */
+	static TRange<int32> PlaybackFrameRange(ULevelSequence* LevelSequence);
+
+	/**
+	 * Counts display frames inside the range that are covered by camera cut sections,
+	 * an unbounded range counts frames of the whole playback range
+	*/
+	int32 CutSectionFrameCount(const TRange<int32>& FrameRange);
+
 	/** Access the sequencer */
 	ISequencer* GetSequencer()
 	{
@@ -49,6 +58,9 @@ public:
 	}
 
 private:
+	/** Converts a range of movie scene ticks to the range of display frames covering it */
+	static TRange<int32> TicksToDisplayFrames(UMovieScene* LevelSequenceMovieScene, const TRange<FFrameNumber>& TickRange);
+
 	/** Sequence movie scene */
 	UMovieScene* MovieScene;
 
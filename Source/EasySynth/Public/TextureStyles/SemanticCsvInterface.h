@@ -22,4 +22,10 @@ public:
 
 	/** Handles exporting semantic classes into a CSV file */
 	bool ExportSemanticClasses(const FString& OutputDir, UTextureMappingAsset* TextureMappingAsset);
+
+	/**
+	 * Handles exporting the index, name and color of each semantic class into a CSV file,
+	 * indices match pixel values of class index semantic images, including the reserved unknown index
+	*/
+	bool ExportSemanticClassIndices(const FString& OutputDir, UTextureMappingAsset* TextureMappingAsset);
 };
@@ -67,6 +67,9 @@ public:
 	/** Returns array of const pointers to semantic classes */
 	TArray<const FSemanticClass*> SemanticClasses() const;
 
+	/** Returns the semantic class name of the actor, or an empty string if it has no class */
+	FString ActorClassName(const FGuid& ActorGuid) const;
+
 	/** Applies desired class to all selected actors */
 	void ApplySemanticClassToSelectedActors(const FString& ClassName);
 
@@ -85,6 +88,15 @@ public:
 	/** Export current semantic classes to a CSV file */
 	bool ExportSemanticClasses(const FString& OutputDir);
 
+	/** Export the class index of each current semantic class to a CSV file */
+	bool ExportSemanticClassIndices(const FString& OutputDir);
+
+	/** Returns the post-process material of the target, loaded once and shared by all renderings */
+	UMaterial* PostProcessMaterial(const FString& TargetName);
+
+	/** The name of the Undefined semantic class */
+	static const FString UndefinedSemanticClassName;
+
 private:
 	/** Load or create texture mapping asset on startup */
 	void LoadOrCreateTextureMappingAsset();
@@ -128,6 +140,10 @@ private:
 	UPROPERTY()
 	UMaterial* PlainColorMaterial;
 
+	/** Loaded post-process materials of renderer targets, keyed by the target name */
+	UPROPERTY()
+	TMap<FString, UMaterial*> PostProcessMaterials;
+
 	/** Currently selected texture style */
 	ETextureStyle CurrentTextureStyle;
 
@@ -150,7 +166,4 @@ private:
 
 	/** The name of the semantic color material parameter */
 	static const FString SemanticColorParameter;
-
-	/** The name of the Undefined semantic class */
-	static const FString UndefinedSemanticClassName;
 };
@@ -77,6 +77,9 @@ private:
 	/** Handles render images button click */
 	FReply OnRenderImagesClicked();
 
+	/** Handles estimate rendering cost button click */
+	FReply OnEstimateRenderCostClicked();
+
 	/** Handles the semantic classes updated event */
 	void OnSemanticClassesUpdated();
 
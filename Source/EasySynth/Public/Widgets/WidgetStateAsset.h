@@ -27,6 +27,14 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Rendering Targets")
 	bool bCameraPosesSelected;
 
+	/** Whether object poses are selected */
+	UPROPERTY(EditAnywhere, Category = "Rendering Targets")
+	bool bObjectPosesSelected;
+
+	/** Whether bounding boxes are selected */
+	UPROPERTY(EditAnywhere, Category = "Rendering Targets")
+	bool bBoundingBoxesSelected;
+
 	/** Whether color images are selected */
 	UPROPERTY(EditAnywhere, Category = "Rendering Targets")
 	bool bColorImagesSelected;
@@ -79,10 +87,58 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Additional parameters")
 	float DepthRange;
 
+	/** Whether depth is written as float values in meters */
+	UPROPERTY(EditAnywhere, Category = "Additional parameters")
+	bool bDepthInMeters;
+
 	/** Selected optical flow scale */
 	UPROPERTY(EditAnywhere, Category = "Additional parameters")
 	float OpticalFlowScale;
 
+	/** Whether optical flow is written as float vectors in pixels */
+	UPROPERTY(EditAnywhere, Category = "Additional parameters")
+	bool bOpticalFlowInPixels;
+
+	/** Whether semantic images are written as class indices */
+	UPROPERTY(EditAnywhere, Category = "Additional parameters")
+	bool bSemanticClassIndices;
+
+	/** Whether EXR targets are written as layers of a single file */
+	UPROPERTY(EditAnywhere, Category = "Additional parameters")
+	bool bMultilayerExr;
+
+	/** Selected dataset shard size in megabytes */
+	UPROPERTY(EditAnywhere, Category = "Additional parameters")
+	int32 DatasetShardSizeMegabytes;
+
+	/** Selected IMU sample rate */
+	UPROPERTY(EditAnywhere, Category = "Additional parameters")
+	float ImuRateHz;
+
+	/** Selected IMU gyroscope noise */
+	UPROPERTY(EditAnywhere, Category = "Additional parameters")
+	float ImuGyroNoise;
+
+	/** Selected IMU accelerometer noise */
+	UPROPERTY(EditAnywhere, Category = "Additional parameters")
+	float ImuAccelNoise;
+
+	/** Whether compatible targets are rendered in a single pass */
+	UPROPERTY(EditAnywhere, Category = "Additional parameters")
+	bool bSinglePassRendering;
+
+	/** Whether all rig cameras are rendered in a single run */
+	UPROPERTY(EditAnywhere, Category = "Additional parameters")
+	bool bParallelRigRendering;
+
+	/** Whether the interrupted rendering is resumed */
+	UPROPERTY(EditAnywhere, Category = "Additional parameters")
+	bool bResumeRendering;
+
+	/** Selected maximum wait for the engine readiness before each render */
+	UPROPERTY(EditAnywhere, Category = "Additional parameters")
+	float ReadinessTimeout = 30.0f;
+
 	/** Selected output image resolution */
 	UPROPERTY(EditAnywhere, Category = "Additional parameters")
 	FIntPoint OutputImageResolution;